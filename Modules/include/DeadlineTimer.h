@@ -0,0 +1,47 @@
+#ifndef CHIMERATK_APPLICATION_CORE_DEADLINE_TIMER_H
+#define CHIMERATK_APPLICATION_CORE_DEADLINE_TIMER_H
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+
+#include <time.h>
+
+namespace ChimeraTK {
+
+  /** Helpers for the trigger modules sending ticks at absolute deadlines (PeriodicTrigger, MultiRateTrigger). */
+  namespace DeadlineTimer {
+
+    /** Sleep until the given absolute deadline. The steady_clock is based on CLOCK_MONOTONIC, so the deadline can be
+     *  passed to clock_nanosleep() directly. This avoids the rounding and drift of relative sleeps.
+     *
+     *  If a spin threshold is given, the thread wakes up this time before the deadline and busy-waits for the rest. */
+    inline void sleepUntil(std::chrono::steady_clock::time_point deadline,
+        std::chrono::steady_clock::duration spinThreshold = std::chrono::steady_clock::duration::zero()) {
+      auto wakeUp = std::chrono::duration_cast<std::chrono::nanoseconds>((deadline - spinThreshold).time_since_epoch());
+      timespec ts;
+      ts.tv_sec = wakeUp.count() / 1000000000;
+      ts.tv_nsec = wakeUp.count() % 1000000000;
+      while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {
+      }
+      if(spinThreshold == std::chrono::steady_clock::duration::zero()) return;
+      while(std::chrono::steady_clock::now() < deadline) {
+      }
+    }
+
+    /** Skip the deadlines which have been missed entirely. If the given time is at least one period after the
+     *  deadline, the deadline is advanced by the number of full periods passed since, and this number is returned.
+     *  Otherwise, and for a period of 0, the deadline is left unchanged and 0 is returned. */
+    inline uint64_t skipMissedDeadlines(std::chrono::steady_clock::time_point& deadline,
+        std::chrono::steady_clock::time_point now, std::chrono::steady_clock::duration period) {
+      if(period <= std::chrono::steady_clock::duration::zero() || now - deadline < period) return 0;
+      auto missed = (now - deadline) / period;
+      deadline += missed * period;
+      return static_cast<uint64_t>(missed);
+    }
+
+  } // namespace DeadlineTimer
+
+} // namespace ChimeraTK
+
+#endif // CHIMERATK_APPLICATION_CORE_DEADLINE_TIMER_H
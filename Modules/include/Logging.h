@@ -102,8 +102,10 @@
  send messages via the Logger object to the Logging module at the same time.
  *
  *  \attention If sendMessage is called multiple times in a sequence some messages might get lost.
- *  This is because of the internal buffer used by ChimeraTK, that has a size of 3. If the LoggingModule
- *  is not done processing a message, the internal buffer is full and a new message arrives it is dropped.
+ *  This is because of the internal buffer used by ChimeraTK, that has a size of 3 by default. If the LoggingModule
+ *  is not done processing a message, the internal buffer is full and a new message arrives it is dropped. The buffer
+ *  size can be increased with setQueueLength() on the message output of the Logger (or globally with
+ *  Application::setDefaultQueueLength()).
 
  */
 
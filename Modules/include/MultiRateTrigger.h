@@ -0,0 +1,103 @@
+#ifndef CHIMERATK_APPLICATION_CORE_MULTI_RATE_TRIGGER_H
+#define CHIMERATK_APPLICATION_CORE_MULTI_RATE_TRIGGER_H
+
+#include "ApplicationCore.h"
+#include "DeadlineTimer.h"
+
+#include <chrono>
+#include <utility>
+#include <vector>
+
+namespace ChimeraTK {
+
+  /**
+   * Trigger generator deriving several phase-locked tick outputs from a single timer thread. Each output fires on
+   * every n-th period of the base timer, where n is the divider of the output. Compared to one PeriodicTrigger per
+   * rate, this needs only one thread and the outputs do not drift against each other.
+   *
+   * All outputs firing on the same base period are written with the same VersionNumber, so data triggered by
+   * different outputs is aligned in downstream modules. The value of each output is the number of its periods
+   * elapsed since the start, i.e. the base tick divided by the divider.
+   *
+   * The base timer uses absolute deadlines. If deadlines are missed by more than one base period, the missed base
+   * ticks are skipped and counted in missedTicks. Outputs which were due in the skipped periods fire on the next
+   * base tick, so slow outputs do not lose their ticks.
+   */
+  struct MultiRateTrigger : public ApplicationModule {
+    /** Constructor. In addition to the usual arguments of an ApplicationModule, the base period and the list of tick
+     *  outputs is specified. Each entry in the list consists of the output name and the divider (must be > 0). */
+    MultiRateTrigger(EntityOwner* owner, const std::string& name, const std::string& description,
+        std::chrono::microseconds basePeriod, const std::vector<std::pair<std::string, uint32_t>>& outputs,
+        HierarchyModifier hierarchyModifier = HierarchyModifier::none,
+        const std::unordered_set<std::string>& tags = {})
+    : ApplicationModule(owner, name, description, hierarchyModifier, tags), _basePeriod(basePeriod) {
+      if(_basePeriod.count() <= 0) {
+        throw ChimeraTK::logic_error("MultiRateTrigger '" + name + "': the base period must be positive.");
+      }
+      for(auto& output : outputs) {
+        if(output.second == 0) {
+          throw ChimeraTK::logic_error(
+              "MultiRateTrigger '" + name + "': the divider of '" + output.first + "' must not be 0.");
+        }
+        tick.push_back(ScalarOutput<uint64_t>(this, output.first, "",
+            "Timer tick with a period of " + std::to_string(output.second) + " base periods of " +
+                std::to_string(_basePeriod.count()) + " us. Counts the periods since the start."));
+        _dividers.push_back(output.second);
+      }
+    }
+
+    MultiRateTrigger() {}
+
+    /** Tick outputs in the order given to the constructor */
+    std::vector<ScalarOutput<uint64_t>> tick;
+
+    ScalarOutput<uint64_t> missedTicks{
+        this, "missedTicks", "", "Number of base ticks skipped since the start because their deadline was missed"};
+
+    void prepare() override {
+      setCurrentVersionNumber({});
+      writeAll(); // send initial values
+    }
+
+    void mainLoop() override {
+      if(Application::getInstance().isTestableModeEnabled()) {
+        return;
+      }
+
+      uint64_t baseTick = 0;
+      auto deadline = std::chrono::steady_clock::now();
+
+      while(true) {
+        uint64_t lastBaseTick = baseTick;
+        ++baseTick;
+        deadline += _basePeriod;
+        boost::this_thread::interruption_point();
+        DeadlineTimer::sleepUntil(deadline);
+
+        // skip base ticks which could not be sent in time
+        auto now = std::chrono::steady_clock::now();
+        uint64_t missed = DeadlineTimer::skipMissedDeadlines(deadline, now, _basePeriod);
+        baseTick += missed;
+
+        // all outputs due in this base tick share one version number, which is also used for missedTicks
+        setCurrentVersionNumber({});
+        if(missed > 0) {
+          missedTicks += missed;
+          missedTicks.write();
+        }
+        for(size_t i = 0; i < tick.size(); ++i) {
+          if(baseTick / _dividers[i] == lastBaseTick / _dividers[i]) continue;
+          tick[i] = baseTick / _dividers[i];
+          tick[i].write();
+        }
+      }
+    }
+
+   private:
+    std::chrono::microseconds _basePeriod{1};
+    std::vector<uint32_t> _dividers;
+  };
+
+} // namespace ChimeraTK
+
+#endif // CHIMERATK_APPLICATION_CORE_MULTI_RATE_TRIGGER_H
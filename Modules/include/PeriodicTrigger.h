@@ -2,14 +2,83 @@
 #define CHIMERATK_APPLICATION_CORE_PERIODIC_TRIGGER_H
 
 #include "ApplicationCore.h"
+#include "DeadlineTimer.h"
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <cmath>
+#include <cstring>
+
+#include <pthread.h>
+#include <sched.h>
 
 namespace ChimeraTK {
 
+  /**
+   * Statistics of the delays of a trigger after its deadlines, in microseconds. Mean, maximum and jitter (standard
+   * deviation) cover the delays recorded since the last reset(). The histogram covers all delays since the
+   * construction: bin 0 counts delays below 1 us, bin i counts delays in [2^(i-1), 2^i) us and the last bin also
+   * counts all longer delays.
+   */
+  class LatencyStatistics {
+   public:
+    static constexpr size_t nHistogramBins{16};
+
+    void record(std::chrono::steady_clock::duration latency) {
+      double us = std::chrono::duration<double, std::micro>(latency).count();
+      sum_ += us;
+      sumSquared_ += us * us;
+      max_ = std::max(max_, us);
+      ++count_;
+
+      auto integerUs = static_cast<uint64_t>(us);
+      size_t bin = 0;
+      while(integerUs > 0 && bin < nHistogramBins - 1) {
+        integerUs >>= 1;
+        ++bin;
+      }
+      ++histogram_[bin];
+    }
+
+    /** Reset mean, maximum and jitter. The histogram is kept. */
+    void reset() {
+      sum_ = 0;
+      sumSquared_ = 0;
+      max_ = 0;
+      count_ = 0;
+    }
+
+    size_t count() const { return count_; }
+
+    double mean() const { return count_ > 0 ? sum_ / count_ : 0.; }
+
+    double max() const { return max_; }
+
+    double jitter() const {
+      if(count_ == 0) return 0.;
+      double m = mean();
+      return std::sqrt(std::max(0., sumSquared_ / count_ - m * m));
+    }
+
+    const std::array<uint64_t, nHistogramBins>& histogram() const { return histogram_; }
+
+   private:
+    double sum_{0};
+    double sumSquared_{0};
+    double max_{0};
+    size_t count_{0};
+    std::array<uint64_t, nHistogramBins> histogram_{};
+  };
+
   /**
    * Simple periodic trigger that fires a variable once per second.
    * After configurable number of seconds it will wrap around
+   *
+   * The trigger is sent at absolute deadlines, so the period does not drift. If a deadline is missed by more than one
+   * period (e.g. because the system was busy), the missed ticks are skipped and counted in statistics/missedTicks,
+   * instead of being sent in a burst. The delay of each trigger after its deadline is recorded and published once per
+   * second in the statistics group.
    */
   struct PeriodicTrigger : public ApplicationModule {
     /** Constructor. In addition to the usual arguments of an ApplicationModule,
@@ -24,11 +93,52 @@ namespace ChimeraTK {
     ScalarPollInput<uint32_t> period{this, "period", "ms",
         "period in milliseconds. The trigger is "
         "sent once per the specified duration."};
+    ScalarPollInput<uint32_t> periodMicroseconds{this, "periodMicroseconds", "us",
+        "period in microseconds. If non-zero, it takes precedence over the period in milliseconds."};
     ScalarOutput<uint64_t> tick{this, "tick", "", "Timer tick. Counts the trigger number starting from 0."};
 
+    /** Number of bins of the latency histogram */
+    static constexpr size_t nHistogramBins{LatencyStatistics::nHistogramBins};
+
+    struct Statistics : VariableGroup {
+      using VariableGroup::VariableGroup;
+      ScalarOutput<uint64_t> missedTicks{
+          this, "missedTicks", "", "Number of ticks skipped since the start because their deadline was missed"};
+      ScalarOutput<float> latencyMean{
+          this, "latencyMean", "us", "Mean delay of the trigger after its deadline in the last second"};
+      ScalarOutput<float> latencyMax{
+          this, "latencyMax", "us", "Maximum delay of the trigger after its deadline in the last second"};
+      ScalarOutput<float> jitter{
+          this, "jitter", "us", "Standard deviation of the delay of the trigger after its deadline in the last second"};
+      ArrayOutput<uint64_t> latencyHistogram{this, "latencyHistogram", "", nHistogramBins,
+          "Histogram of the delay of the trigger after its deadline since the start. Bin 0 counts delays below 1 us, "
+          "bin i counts delays in [2^(i-1), 2^i) us and the last bin also counts all longer delays."};
+    } statistics{this, "statistics", "Timing statistics of the trigger"};
+
+    /** Wake up the given time before each deadline and busy-wait for the rest, which reduces the jitter to the
+     *  resolution of the clock at the price of CPU time. Use this for periods below about 1 ms. The default is 0, i.e.
+     *  no busy-waiting. Must be called before Application::run(). */
+    void setSpinThreshold(std::chrono::microseconds threshold) {
+      if(threshold.count() < 0) {
+        throw ChimeraTK::logic_error("PeriodicTrigger '" + getName() + "': the spin threshold must not be negative.");
+      }
+      spinThreshold_ = threshold;
+    }
+
+    /** Run the trigger thread with the real-time scheduling policy SCHED_FIFO at the given priority (1 to 99). 0 (the
+     *  default) keeps the normal scheduling policy. If the process lacks the permission (CAP_SYS_NICE or a matching
+     *  RLIMIT_RTPRIO), a warning is printed and the normal policy is kept. Must be called before Application::run(). */
+    void setRealtimePriority(int priority) {
+      if(priority < 0 || priority > 99) {
+        throw ChimeraTK::logic_error("PeriodicTrigger '" + getName() + "': the real-time priority must be in 0..99.");
+      }
+      realtimePriority_ = priority;
+    }
+
     void prepare() override {
       setCurrentVersionNumber({});
       tick.write(); // send initial value
+      statistics.writeAll();
     }
 
     void sendTrigger() {
@@ -41,26 +151,64 @@ namespace ChimeraTK {
       if(Application::getInstance().isTestableModeEnabled()) {
         return;
       }
+      if(realtimePriority_ > 0) enableRealtimeScheduling();
+
       tick = 0;
-      std::chrono::time_point<std::chrono::steady_clock> t = std::chrono::steady_clock::now();
+      auto deadline = std::chrono::steady_clock::now();
+      auto nextStatistics = deadline + std::chrono::seconds(1);
 
       while(true) {
         period.read();
-        if(period == 0) {
+        periodMicroseconds.read();
+        std::chrono::nanoseconds currentPeriod = std::chrono::microseconds(periodMicroseconds);
+        if(currentPeriod.count() == 0) {
           // set receiving end of timeout. Will only be overwritten if there is
           // new data.
-          period = defaultPeriod_;
+          if(period == 0) period = defaultPeriod_;
+          currentPeriod = std::chrono::milliseconds(static_cast<uint32_t>(period));
         }
-        t += std::chrono::milliseconds(static_cast<uint32_t>(period));
+        deadline += currentPeriod;
         boost::this_thread::interruption_point();
-        std::this_thread::sleep_until(t);
+        DeadlineTimer::sleepUntil(deadline, spinThreshold_);
+
+        // skip ticks which could not be sent in time
+        auto now = std::chrono::steady_clock::now();
+        statistics.missedTicks += DeadlineTimer::skipMissedDeadlines(deadline, now, currentPeriod);
+        latency_.record(now - deadline);
 
         sendTrigger();
+
+        if(now >= nextStatistics) {
+          publishStatistics();
+          nextStatistics = now + std::chrono::seconds(1);
+        }
       }
     }
 
    private:
+    void enableRealtimeScheduling() {
+      sched_param param{};
+      param.sched_priority = realtimePriority_;
+      int ret = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+      if(ret != 0) {
+        std::cerr << "*** Warning: PeriodicTrigger '" << getName()
+                  << "' cannot use the real-time scheduling policy: " << std::strerror(ret) << std::endl;
+      }
+    }
+
+    void publishStatistics() {
+      statistics.latencyMean = latency_.mean();
+      statistics.latencyMax = latency_.max();
+      statistics.jitter = latency_.jitter();
+      for(size_t i = 0; i < nHistogramBins; ++i) statistics.latencyHistogram[i] = latency_.histogram()[i];
+      statistics.writeAll();
+      latency_.reset();
+    }
+
     uint32_t defaultPeriod_;
+    std::chrono::microseconds spinThreshold_{0};
+    int realtimePriority_{0};
+    LatencyStatistics latency_;
   };
 } // namespace ChimeraTK
 
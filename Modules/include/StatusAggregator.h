@@ -76,8 +76,8 @@ namespace ChimeraTK {
 
     void mainLoop() override;
 
-    void findTagAndAppendToModule(VirtualModule& virtualParent, const std::string& tag, bool eliminateAllHierarchies,
-        bool eliminateFirstHierarchy, bool negate, VirtualModule& root) const override;
+    void findTagAndAppendToModule(VirtualModule& virtualParent, const TagIndex::Match& tag,
+        bool eliminateAllHierarchies, bool eliminateFirstHierarchy, bool negate, VirtualModule& root) const override;
 
    protected:
     /// Recursivly search for StatusMonitors and other StatusAggregators
@@ -163,7 +163,7 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
-  void StatusAggregator::findTagAndAppendToModule(VirtualModule& virtualParent, const std::string& tag,
+  void StatusAggregator::findTagAndAppendToModule(VirtualModule& virtualParent, const TagIndex::Match& tag,
       bool eliminateAllHierarchies, bool eliminateFirstHierarchy, bool negate, VirtualModule& root) const {
     // Change behaviour to exclude the auto-generated inputs which are connected to the data sources. Otherwise those
     // variables might get published twice to the control system, if findTag(".*") is used to connect the entire
@@ -180,7 +180,7 @@ namespace ChimeraTK {
     MyVirtualModule tempParent("tempRoot", "", ModuleType::ApplicationModule);
     MyVirtualModule tempRoot("tempRoot", "", ModuleType::ApplicationModule);
     EntityOwner::findTagAndAppendToModule(
-        tempParent, tagInternalVars, eliminateAllHierarchies, eliminateFirstHierarchy, true, tempRoot);
+        tempParent, TagIndex::match(tagInternalVars), eliminateAllHierarchies, eliminateFirstHierarchy, true, tempRoot);
     tempParent.findTagAndAppendToModule(virtualParent, tag, false, true, negate, root);
     tempRoot.findTagAndAppendToModule(root, tag, false, true, negate, root);
   }
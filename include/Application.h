@@ -17,7 +17,10 @@
 #include "EntityOwner.h"
 #include "Flags.h"
 #include "InternalModule.h"
+#include "ModuleExecutor.h"
 #include "Profiler.h"
+#include "ReconnectPolicy.h"
+#include "StartupProfile.h"
 #include "VariableNetwork.h"
 //#include "DeviceModule.h"
 
@@ -111,6 +114,60 @@ namespace ChimeraTK {
      **/
     bool isTestableModeEnabled() { return testableMode; }
 
+    /** Enable the pooled execution of PooledApplicationModules. Instead of running each of these modules in its own
+     *  thread, they are executed by a fixed-size pool of worker threads, which is woken up when any of the push-type
+     *  inputs of a module has received new data. If nThreads is 0, one worker thread per CPU core is used. Modules
+     *  directly derived from ApplicationModule are not affected and keep running in their own thread.
+     *
+     *  This function must be called before the application is run. In testable mode, the pooled execution is not
+     *  used. */
+    void enableModuleExecutor(size_t nThreads = 0) {
+      moduleExecutorEnabled = true;
+      moduleExecutorThreads = nThreads;
+    }
+
+    /** Returns true if the pooled execution of PooledApplicationModules has been enabled. */
+    bool isModuleExecutorEnabled() const { return moduleExecutorEnabled; }
+
+    /** Enable the shared fan-out dispatcher. Instead of running one thread per ThreadedFanOut (which are e.g. created
+     *  for direct connections between the control system and devices), the feeders of all ThreadedFanOuts are
+     *  observed by a single dispatcher thread and the data is distributed by a small pool of nThreads worker threads.
+     *  Fan-outs with return channel keep their own thread.
+     *
+     *  This function must be called before the application is run. In testable mode, the dispatcher is not used. */
+    void enableFanOutDispatcher(size_t nThreads = 2) {
+      fanOutDispatcherEnabled = true;
+      fanOutDispatcherThreads = nThreads;
+    }
+
+    /** Enable the pipelined mode of the TriggerFanOuts. Each TriggerFanOut then uses a second thread to distribute the
+     *  data to the consumers, while the next trigger is awaited and the device is read again. The data of at most one
+     *  trigger is distributed while the next one is acquired, so the consumers still receive all values in order.
+     *  This allows high trigger rates if there are many consumers.
+     *
+     *  This function must be called before the application is run. In testable mode, the pipelined mode is not
+     *  used. */
+    void enableTriggerPipelining() { triggerPipeliningEnabled = true; }
+
+    /** Print the durations of the startup phases recorded so far. These are the phases of initialise() and run(), the
+     *  first opening and initialisation of each device, and the time from the start of run() until each
+     *  ApplicationModule has received its initial values and entered its main loop. */
+    void printStartupProfile(std::ostream& stream = std::cout) const { startupProfile.print(stream); }
+
+    /** Publish the durations of the startup phases (see printStartupProfile()) as process variables in milliseconds
+     *  below /Application/startupProfile, e.g. /Application/startupProfile/run/total. Must be called before the
+     *  application is initialised.
+     *
+     *  The process variables are created directly by the process variable manager when initialise() is called. They
+     *  are not part of any VariableNetwork, hence they are not listed by generateXML() and are not controlled by the
+     *  testable mode. */
+    void publishStartupProfile() {
+      if(initialiseCalled) {
+        throw ChimeraTK::logic_error("Application::publishStartupProfile() must be called before initialise().");
+      }
+      startupProfilePublished = true;
+    }
+
     /** Resume the application until all application threads are stuck in a blocking read operation. Works only when
      *  the testable mode was enabled.
      *  The optional argument controls whether to wait as well for devices to be completely (re-)initialised. Disabling
@@ -189,6 +246,32 @@ namespace ChimeraTK {
      *  initialisation phase of application. */
     void enableDebugDataLoss() { debugDataLoss = true; }
 
+    /** Set the length of the queues transporting the data of push-type variables, unless a longer queue has been
+     *  requested for the variable (see VariableNetworkNode::setQueueLength()). Must be called before the application
+     *  is initialised. The default is 3. */
+    void setDefaultQueueLength(size_t length) {
+      if(initialiseCalled) {
+        throw ChimeraTK::logic_error("Application::setDefaultQueueLength() must be called before initialise().");
+      }
+      if(length < 2) {
+        throw ChimeraTK::logic_error("Application::setDefaultQueueLength(): The queue length must be at least 2.");
+      }
+      defaultQueueLength = length;
+    }
+
+    /** Return the default queue length, see setDefaultQueueLength(). */
+    size_t getDefaultQueueLength() const { return defaultQueueLength; }
+
+    /** Set the policy for opening and recovering devices, used by all DeviceModules which do not have their own policy
+     *  (see DeviceModule::setReconnectPolicy()). Must be called before the application is run. */
+    void setDefaultReconnectPolicy(const ReconnectPolicy& policy) {
+      policy.check("Application::setDefaultReconnectPolicy()");
+      defaultReconnectPolicy = policy;
+    }
+
+    /** Return the default reconnect policy, see setDefaultReconnectPolicy(). */
+    const ReconnectPolicy& getDefaultReconnectPolicy() const { return defaultReconnectPolicy; }
+
     /** Incremenet counter for how many write() operations have overwritten unread data */
     static void incrementDataLossCounter(const std::string& name) {
       if(getInstance().debugDataLoss) {
@@ -303,6 +386,9 @@ namespace ChimeraTK {
      * sharing the same feeder. */
     void optimiseConnections();
 
+    /** Record the startup phase which has ended now. It started at the end of the previous phase. */
+    void recordStartupPhase(const std::string& phase);
+
     /** Make the connections for a single network */
     void makeConnectionsForNetwork(VariableNetwork& network);
 
@@ -335,9 +421,12 @@ namespace ChimeraTK {
     /** Register a connection between two VariableNetworkNode */
     VariableNetwork& connect(VariableNetworkNode a, VariableNetworkNode b);
 
-    /** Perform the actual connection of an accessor to a device register */
+    /** Perform the actual connection of an accessor to a device register. If the accessor will be directly used by
+     *  an application accessor, pass the application node as appNode. Outside the testable mode, the meta data
+     *  propagation is then fused into the exception handling decorator. */
     template<typename UserType>
-    boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>> createDeviceVariable(VariableNetworkNode const& node);
+    boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>> createDeviceVariable(
+        VariableNetworkNode const& node, VariableNetworkNode const& appNode = {});
 
     /** Create a process variable with the PVManager, which is exported to the
        control system adapter. nElements will be the array size of the created
@@ -484,6 +573,45 @@ namespace ChimeraTK {
     /** Flag whether to debug data loss (as counted with the data loss counter). */
     bool debugDataLoss{false};
 
+    /** Default length of the data transport queues, see setDefaultQueueLength() */
+    size_t defaultQueueLength{3};
+
+    /** Default policy for opening and recovering devices, see setDefaultReconnectPolicy() */
+    ReconnectPolicy defaultReconnectPolicy;
+
+    /** Flag whether the pooled execution of PooledApplicationModules is enabled, see enableModuleExecutor() */
+    bool moduleExecutorEnabled{false};
+
+    /** Number of worker threads for the pooled execution, 0 means one per CPU core */
+    size_t moduleExecutorThreads{0};
+
+    /** Worker pool executing the PooledApplicationModules */
+    ModuleExecutor moduleExecutor;
+
+    /** Flag whether the shared fan-out dispatcher is enabled, see enableFanOutDispatcher() */
+    bool fanOutDispatcherEnabled{false};
+
+    /** Number of worker threads of the fan-out dispatcher */
+    size_t fanOutDispatcherThreads{2};
+
+    /** Dispatcher executing the ThreadedFanOuts */
+    ModuleExecutor fanOutDispatcher;
+
+    /** Flag whether the TriggerFanOuts distribute their data in a separate thread, see enableTriggerPipelining() */
+    bool triggerPipeliningEnabled{false};
+
+    /** Durations of the startup phases, see printStartupProfile() */
+    StartupProfile startupProfile;
+
+    /** Flag whether the startup profile is published as process variables, see publishStartupProfile() */
+    bool startupProfilePublished{false};
+
+    /** Time when run() has been called, used as reference for the startup of the modules */
+    std::chrono::steady_clock::time_point runStartTime;
+
+    /** Start of the current startup phase, see recordStartupPhase() */
+    std::chrono::steady_clock::time_point startupPhaseStart;
+
     /** Life-cycle state of the application */
     std::atomic<LifeCycleState> lifeCycleState{LifeCycleState::initialisation};
 
@@ -508,8 +636,8 @@ namespace ChimeraTK {
 
     friend class TestFacility;  // needs access to testableMode_variables
     friend class DeviceModule;  // needs access to testableMode_variables
-    friend class DeviceModule;  // needs access to testableMode_variables
-    friend class TriggerFanOut; // needs access to testableMode_variables
+    friend class DeviceModule;  // needs access to testableMode_variables and startupProfile
+    friend class TriggerFanOut; // needs access to testableMode_variables and triggerPipeliningEnabled
 
     friend class ControlSystemModule; // needs access to controlSystemVariables
 
@@ -517,7 +645,11 @@ namespace ChimeraTK {
     friend class DebugPrintAccessorDecorator; // needs access to the idMap
     template<typename UserType>
     friend class MetaDataPropagatingRegisterDecorator; // needs to access circularNetworkInvalidityCounters
-    friend class ApplicationModule;                    // needs to access circularNetworkInvalidityCounters
+    friend class MetaDataPropagationFlagProvider;      // needs to access circularNetworkInvalidityCounters
+    friend class ApplicationModule;                    // needs to access circularNetworkInvalidityCounters etc.
+    friend class PooledApplicationModule;              // needs to access moduleExecutor and startupProfile
+    template<typename UserType>
+    friend class ThreadedFanOut; // needs to access fanOutDispatcher
 
     VersionNumber getCurrentVersionNumber() const override {
       throw ChimeraTK::logic_error("getCurrentVersionNumber() called on the application. This is probably "
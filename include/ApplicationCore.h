@@ -19,6 +19,7 @@
 #include "ControlSystemModule.h"
 #include "DeviceModule.h"
 #include "ModuleGroup.h"
+#include "PooledApplicationModule.h"
 #include "ScalarAccessor.h"
 #include "VariableGroup.h"
 #include "HierarchyModifyingGroup.h"
@@ -0,0 +1,141 @@
+#ifndef CHIMERATK_CONFLATING_ACCESSOR_H
+#define CHIMERATK_CONFLATING_ACCESSOR_H
+
+#include <array>
+#include <atomic>
+
+#include <ChimeraTK/NDRegisterAccessor.h>
+
+#include "TransportSlot.h"
+
+namespace ChimeraTK {
+
+  namespace detail {
+
+    /** Shared state of a sender/receiver pair of ConflatingAccessors. The data is exchanged through a lock-free triple
+     *  buffer: the sender and the receiver each own one slot, the third slot holds the latest value which has not
+     *  yet been taken by the receiver. Slots are exchanged by swapping their indices atomically, so neither side
+     *  ever blocks and no memory is allocated after construction. */
+    template<typename UserType>
+    struct ConflatingBuffer {
+      explicit ConflatingBuffer(size_t nElements) : nElements(nElements) {
+        for(auto& slot : slots) slot.allocate(nElements);
+      }
+
+      size_t nElements;
+
+      std::array<TransportSlot<UserType>, 3> slots;
+
+      /** Index of the slot not owned by either side, combined with the newDataBit if this slot has been written by
+       *  the sender since the receiver has taken the last value. */
+      std::atomic<unsigned int> middle{1};
+
+      static constexpr unsigned int newDataBit{4};
+
+      /** Wakes up the receiver. An element is pushed only when the newDataBit gets set, so there is never more than one
+       *  notification pending. The second slot in the queue leaves room for the exception pushed by interrupt(). */
+      cppext::future_queue<void> notifications{2};
+    };
+
+  } // namespace detail
+
+  /********************************************************************************************************************/
+
+  /** Implementation of a push-type process variable which only transports the latest value. If the sender writes
+   *  faster than the receiver reads, intermediate values are dropped. This is intended for variables like set points
+   *  and status values, where only the newest value matters. Hence dropped values are not considered as data loss,
+   *  and write() always returns false. The receiver always wakes up with the latest value written.
+   *
+   *  Use createConflatingVariable() to create a connected sender/receiver pair. */
+  template<typename UserType>
+  class ConflatingAccessor : public ChimeraTK::NDRegisterAccessor<UserType> {
+   public:
+    ConflatingAccessor(boost::shared_ptr<detail::ConflatingBuffer<UserType>> buffer, bool isSender,
+        const std::string& name, const std::string& unit, const std::string& description)
+    : ChimeraTK::NDRegisterAccessor<UserType>(name, {AccessMode::wait_for_new_data}, unit, description),
+      _buffer(buffer), _isSender(isSender), _ownSlot(isSender ? 0 : 2) {
+      ChimeraTK::NDRegisterAccessor<UserType>::buffer_2D.resize(1);
+      ChimeraTK::NDRegisterAccessor<UserType>::buffer_2D[0].resize(_buffer->nElements);
+      if(!_isSender) this->_readQueue = _buffer->notifications;
+    }
+
+    void doReadTransferSynchronously() override {}
+
+    void doPreRead(TransferType) override {
+      if(_isSender) throw ChimeraTK::logic_error("Read operation called on write-only variable.");
+    }
+
+    void doPostRead(TransferType, bool hasNewData) override {
+      if(!hasNewData) return;
+      auto index = _buffer->middle.exchange(_ownSlot, std::memory_order_acq_rel);
+      assert(index & detail::ConflatingBuffer<UserType>::newDataBit);
+      _ownSlot = index & ~detail::ConflatingBuffer<UserType>::newDataBit;
+      _buffer->slots[_ownSlot].take(
+          ChimeraTK::NDRegisterAccessor<UserType>::buffer_2D[0], this->_versionNumber, this->_dataValidity);
+    }
+
+    void doPreWrite(TransferType, VersionNumber) override {
+      if(!_isSender) throw ChimeraTK::logic_error("Write operation called on read-only variable.");
+    }
+
+    bool doWriteTransfer(ChimeraTK::VersionNumber versionNumber) override { return publish(versionNumber, false); }
+
+    bool doWriteTransferDestructively(ChimeraTK::VersionNumber versionNumber) override {
+      return publish(versionNumber, true);
+    }
+
+    bool mayReplaceOther(const boost::shared_ptr<ChimeraTK::TransferElement const>&) const override { return false; }
+
+    bool isReadOnly() const override { return !_isSender; }
+
+    bool isReadable() const override { return !_isSender; }
+
+    bool isWriteable() const override { return _isSender; }
+
+    std::vector<boost::shared_ptr<ChimeraTK::TransferElement>> getHardwareAccessingElements() override { return {}; }
+
+    void replaceTransferElement(boost::shared_ptr<ChimeraTK::TransferElement>) override {}
+
+    std::list<boost::shared_ptr<ChimeraTK::TransferElement>> getInternalElements() override { return {}; }
+
+    void interrupt() override {
+      if(!_isSender) TransferElement::interrupt_impl(this->_readQueue);
+    }
+
+   protected:
+    /** Fill the own slot, hand it over to the receiver and take the previous middle slot. */
+    bool publish(ChimeraTK::VersionNumber versionNumber, bool destructive) {
+      _buffer->slots[_ownSlot].fill(
+          ChimeraTK::NDRegisterAccessor<UserType>::buffer_2D[0], versionNumber, this->_dataValidity, destructive);
+      auto previous = _buffer->middle.exchange(
+          _ownSlot | detail::ConflatingBuffer<UserType>::newDataBit, std::memory_order_acq_rel);
+      _ownSlot = previous & ~detail::ConflatingBuffer<UserType>::newDataBit;
+      // If the previous value has not yet been taken, the receiver has not yet consumed the notification for it.
+      if(!(previous & detail::ConflatingBuffer<UserType>::newDataBit)) _buffer->notifications.push();
+      // An overwritten value is intentionally not considered as lost.
+      return false;
+    }
+
+    boost::shared_ptr<detail::ConflatingBuffer<UserType>> _buffer;
+    bool _isSender;
+
+    /** Index of the slot currently owned by this side */
+    unsigned int _ownSlot;
+  };
+
+  /********************************************************************************************************************/
+
+  /** Create a connected pair of ConflatingAccessors. The first element in the returned pair is the sender, the second
+   *  the receiver. */
+  template<typename UserType>
+  std::pair<boost::shared_ptr<NDRegisterAccessor<UserType>>, boost::shared_ptr<NDRegisterAccessor<UserType>>>
+      createConflatingVariable(
+          size_t nElements, const std::string& name, const std::string& unit, const std::string& description) {
+    auto buffer = boost::make_shared<detail::ConflatingBuffer<UserType>>(nElements);
+    return {boost::make_shared<ConflatingAccessor<UserType>>(buffer, true, name, unit, description),
+        boost::make_shared<ConflatingAccessor<UserType>>(buffer, false, name, unit, description)};
+  }
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_CONFLATING_ACCESSOR_H */
@@ -15,6 +15,7 @@
 #include "VariableNetworkNode.h"
 #include "VirtualModule.h"
 #include "RecoveryHelper.h"
+#include "ReconnectPolicy.h"
 #include <ChimeraTK/ForwardDeclarations.h>
 #include <ChimeraTK/RegisterPath.h>
 #include <ChimeraTK/Device.h>
@@ -22,6 +23,9 @@
 #include "StatusAccessor.h"
 #include <boost/thread/latch.hpp>
 
+#include <condition_variable>
+#include <mutex>
+
 namespace ChimeraTK {
   class Application;
   class DeviceModule;
@@ -96,6 +100,10 @@ namespace ChimeraTK {
       owner = other.owner;
       proxies = std::move(other.proxies);
       deviceHasError = other.deviceHasError;
+      deviceState = other.deviceState.load();
+      reconnectPolicy = other.reconnectPolicy;
+      hasReconnectPolicy = other.hasReconnectPolicy;
+      orderedRecovery = other.orderedRecovery;
       for(auto& proxy : proxies) proxy.second._myowner = this;
       owner->registerDeviceModule(this);
       return *this;
@@ -173,10 +181,15 @@ namespace ChimeraTK {
      *
      *  Notice: Especially in network based devices which do not hold a permanent connection, it is not always possible
      *  to predict whether the next read()/write() will succeed. In this case the Device will always report isFunctional()
-     *  and one just has to retry. In this case the DeviceModule will start the initialisation sequence every 500 ms.
+     *  and one just has to retry. In this case the DeviceModule will restart the initialisation sequence according to
+     *  the ReconnectPolicy (see setReconnectPolicy()).
      */
     void addInitialisationHandler(std::function<void(DeviceModule*)> initialisationHandler);
 
+    /** Set the policy for opening and recovering this device. If not set, the default policy of the Application is
+     *  used (see Application::setDefaultReconnectPolicy()). Must be called before the application is run. */
+    void setReconnectPolicy(const ReconnectPolicy& policy);
+
     /** A trigger that indicated that the device just became available again an error (in contrast to the
       *  error status which is also send when the device goes away).
       *  The output is public so your module can connect to it and trigger re-sending of variables that
@@ -189,6 +202,18 @@ namespace ChimeraTK {
     ScalarOutput<int> deviceBecameFunctional{
         this, "deviceBecameFunctional", "", ""}; // should be changed to data type void
 
+    /** Time needed to write the recovery values to the device after it has been opened the last time. It is published
+     *  to the control system next to the deviceBecameFunctional trigger. */
+    ScalarOutput<float> recoveryDuration{
+        this, "recoveryDuration", "ms", "Time needed to write the recovery values in the last recovery"};
+
+    /** Select whether the recovery values must be written in the original write order (default). If disabled, all
+     *  recovery accessors are written through a single TransferGroup, which allows the backend to merge the transfers.
+     *  This is only done once all recovery accessors have received a value and as long as no register is written by
+     *  more than one accessor, since otherwise the order matters for the result. Must be called before the
+     *  application is run. */
+    void setOrderedRecovery(bool ordered) { orderedRecovery = ordered; }
+
     /** Add a TransferElement to the list DeviceModule::writeRecoveryOpen. This list will be written during a recovery,
      * after the constant accessors DeviceModule::writeAfterOpen are written. This is locked by a unique_lock.
      * You can get a shared_lock with getRecoverySharedLock(). */
@@ -257,9 +282,62 @@ namespace ChimeraTK {
     VersionNumber exceptionVersionNumber = {};
     //Intentionally not initialised with nullptr. It is propagated as long as the device is not successfully opened.
 
-    /** The error flag whether the device is functional. protected by the errorMutex. */
+    /** The error flag whether the device is functional. protected by the errorMutex. Use setDeviceHasError() to
+     *  modify it. */
     bool deviceHasError{true};
 
+    /** Set deviceHasError and its copy in the deviceState. Must be called under a unique lock of the errorMutex. */
+    void setDeviceHasError(bool hasError) {
+      deviceHasError = hasError;
+      if(hasError) {
+        deviceState.fetch_or(deviceStateErrorBit);
+      }
+      else {
+        deviceState.fetch_and(~deviceStateErrorBit);
+      }
+    }
+
+    /** State word for the lock-free fast path of the ExceptionHandlingDecorator. Bit 0 is a copy of deviceHasError,
+     *  the remaining bits count the synchronous transfers currently in progress. Since both are modified with atomic
+     *  read-modify-write operations on the same word, a transfer either sees the error flag or is counted before the
+     *  flag is set, in which case the recovery waits for it to finish. */
+    std::atomic<uint64_t> deviceState{deviceStateErrorBit};
+    static constexpr uint64_t deviceStateErrorBit{1};
+    static constexpr uint64_t deviceStateTransferIncrement{2};
+
+    /** Register the start of a synchronous transfer. Returns false without registering if the device has an error. */
+    bool beginSynchronousTransfer() {
+      if(deviceState.fetch_add(deviceStateTransferIncrement) & deviceStateErrorBit) {
+        // The temporary increment might have been seen by waitForSynchronousTransfers(), so it must be undone like a
+        // finished transfer.
+        endSynchronousTransfer();
+        return false;
+      }
+      return true;
+    }
+
+    /** Register the end of a synchronous transfer started with beginSynchronousTransfer(). The last transfer to finish
+     *  while the device has an error wakes up the DeviceModule thread waiting in waitForSynchronousTransfers(). */
+    void endSynchronousTransfer() {
+      if(deviceState.fetch_sub(deviceStateTransferIncrement) == (deviceStateTransferIncrement | deviceStateErrorBit)) {
+        notifySynchronousTransfersFinished();
+      }
+    }
+
+    /** Return whether synchronous transfers are in progress */
+    bool hasSynchronousTransfers() { return deviceState.load() >= deviceStateTransferIncrement; }
+
+    /** Block until all synchronous transfers have finished. Must only be called while the device has an error, since
+     *  otherwise no notification is sent. */
+    void waitForSynchronousTransfers();
+
+    /** Wake up the thread in waitForSynchronousTransfers() */
+    void notifySynchronousTransfersFinished();
+
+    /** Mutex and condition variable for waitForSynchronousTransfers() */
+    std::mutex synchronousTransfersMutex;
+    std::condition_variable synchronousTransfersFinished;
+
     /** Use this function to read the exception version number. It is locking the variable mutex correctly for you. */
     VersionNumber getExceptionVersionNumber();
 
@@ -268,8 +346,30 @@ namespace ChimeraTK {
     void handleException();
 
     /** List of TransferElements to be written after the device has been recovered.
-     *  See function addRecoveryAccessor() for details.*/
-    std::list<boost::shared_ptr<RecoveryHelper>> recoveryHelpers;
+     *  See function addRecoveryAccessor() for details. Only the DeviceModule thread modifies the order of the list, see
+     *  writeRecoveryValues(). */
+    std::vector<boost::shared_ptr<RecoveryHelper>> recoveryHelpers;
+
+    /** The recoveryHelpers are sorted up to this write order. Helpers with a larger writeOrder have been written since
+     *  the last recovery. */
+    uint64_t recoveryHelpersSortedUpTo{0};
+
+    /** Flag whether the recovery values must be written in the original write order, see setOrderedRecovery(). */
+    bool orderedRecovery{true};
+
+    /** TransferGroup with all recovery accessors, used if orderedRecovery is false. Created in the first recovery in
+     *  which all recovery accessors are valid. */
+    boost::shared_ptr<TransferGroup> recoveryGroup;
+
+    /** Flag whether the recoveryGroup cannot be used, since a register is written by more than one accessor */
+    bool recoveryGroupImpossible{false};
+
+    /** Write all valid recovery accessors to the device. Must be called under the unique recovery lock. */
+    void writeRecoveryValues();
+
+    /** Name of the given step of the first opening and initialisation of the device in the startup profile of the
+     *  Application */
+    std::string getStartupPhaseName(const std::string& step) const;
 
     Application* owner{nullptr};
 
@@ -278,6 +378,11 @@ namespace ChimeraTK {
     /* The list of initialisation handler callback functions */
     std::list<std::function<void(DeviceModule*)>> initialisationHandlers;
 
+    /** Policy for opening and recovering the device, only valid if hasReconnectPolicy is set. Otherwise the default
+     *  policy of the Application is used. */
+    ReconnectPolicy reconnectPolicy;
+    bool hasReconnectPolicy{false};
+
     /** Mutex for writing the DeviceModule::writeRecoveryOpen.*/
     boost::shared_mutex recoveryMutex;
 
@@ -286,7 +391,6 @@ namespace ChimeraTK {
     bool isHoldingInitialValueLatch{true};
     boost::latch initialValueLatch{1};
 
-    std::atomic<int64_t> synchronousTransferCounter{0};
     std::atomic<uint64_t> writeOrderCounter{0};
 
     std::list<RegisterPath> writeRegisterPaths;
@@ -234,9 +234,9 @@ namespace ChimeraTK {
 
    protected:
     /** Add the part of the tree structure matching the given tag to a
-     * VirtualModule. Users normally will use findTag() instead. "tag" is
-     * interpreted as a regular expression (see std::regex_match). */
-    virtual void findTagAndAppendToModule(VirtualModule& virtualParent, const std::string& tag,
+     * VirtualModule. Users normally will use findTag() instead. "tag" is the
+     * tag expression already resolved by TagIndex::match(). */
+    virtual void findTagAndAppendToModule(VirtualModule& virtualParent, const TagIndex::Match& tag,
         bool eliminateAllHierarchies, bool eliminateFirstHierarchy, bool negate, VirtualModule& root) const;
 
     /** The name of this instance */
@@ -65,6 +65,21 @@ namespace ChimeraTK {
 
     template<typename Callable>
     bool genericWriteWrapper(Callable writeFunction);
+
+    /** Copy the user buffer into the recovery accessor and update the recovery helper. Must be called either with a
+     *  registered synchronous transfer or under the recovery lock. */
+    void updateRecoveryAccessor(VersionNumber versionNumber);
+
+    /** Update version number and write order of the recovery helper, without touching the data */
+    void updateRecoveryHelper(VersionNumber versionNumber);
+
+    // Data of the last destructive write, retained for the recovery without copying it (see doPreWrite()). Only access
+    // with a registered synchronous transfer or under the recovery lock.
+    std::vector<std::vector<UserType>> _retainedBuffer;
+    // Flag whether the data for the recovery is in _retainedBuffer and not yet in the _recoveryAccessor
+    bool _recoveryDataRetained{false};
+    // Flag whether the current write retains the data in doPostWrite()
+    bool _retainInPostWrite{false};
   };
 
   DECLARE_TEMPLATE_FOR_CHIMERATK_USER_TYPES(ExceptionHandlingDecorator);
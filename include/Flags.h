@@ -31,7 +31,16 @@ namespace ChimeraTK {
   enum class UpdateMode { poll, push, invalid };
 
   /** Enum to define types of VariableNetworkNode */
-  enum class NodeType { Device, ControlSystem, Application, TriggerReceiver, TriggerProvider, Constant, invalid };
+  enum class NodeType {
+    Device,
+    ControlSystem,
+    Application,
+    TriggerReceiver,
+    TriggerProvider,
+    Constant,
+    Timer,
+    invalid
+  };
 
   /** Hierarchy modifier: specify if and how the module hierarchy should be modified in EntityOwner::findTag() etc. */
   enum class HierarchyModifier {
@@ -0,0 +1,38 @@
+#ifndef CHIMERATK_FUSED_DEVICE_ACCESSOR_DECORATOR_H
+#define CHIMERATK_FUSED_DEVICE_ACCESSOR_DECORATOR_H
+
+#include "ExceptionHandlingDecorator.h"
+#include "MetaDataPropagatingRegisterDecorator.h"
+
+namespace ChimeraTK {
+
+  /**
+   *  Decorator for device accessors which are directly connected to an ApplicationModule. It combines the
+   *  ExceptionHandlingDecorator and the MetaDataPropagatingRegisterDecorator into a single layer, which saves one
+   *  level of virtual calls and one buffer swap per transfer.
+   *
+   *  This is only used in the production configuration. In testable mode the TestableModeAccessorDecorator has to sit
+   *  between both decorators, so the separate decorators are used instead.
+   */
+  template<typename UserType>
+  class FusedDeviceAccessorDecorator : public ExceptionHandlingDecorator<UserType>,
+                                       public MetaDataPropagationFlagProvider {
+   public:
+    FusedDeviceAccessorDecorator(boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>> accessor,
+        VariableNetworkNode networkNode, EntityOwner* owner);
+
+    void doPreWrite(TransferType type, VersionNumber versionNumber) override;
+
+    void doPostRead(TransferType type, bool hasNewData) override;
+
+   protected:
+    EntityOwner* _owner;
+
+    using TransferElement::_dataValidity;
+  };
+
+  DECLARE_TEMPLATE_FOR_CHIMERATK_USER_TYPES(FusedDeviceAccessorDecorator);
+
+} /* namespace ChimeraTK */
+
+#endif // CHIMERATK_FUSED_DEVICE_ACCESSOR_DECORATOR_H
@@ -45,7 +45,7 @@ namespace ChimeraTK {
 
    protected:
 
-    void findTagAndAppendToModule(VirtualModule& virtualParent, const std::string& tag,
+    void findTagAndAppendToModule(VirtualModule& virtualParent, const TagIndex::Match& tag,
         bool eliminateAllHierarchies, bool eliminateFirstHierarchy, bool negate, VirtualModule& root) const override;
 
     bool moveToRoot{false};
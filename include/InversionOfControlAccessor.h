@@ -50,6 +50,20 @@ namespace ChimeraTK {
       for(auto& tag : tags) node.addTag(tag);
     }
 
+    /** Request a minimum length for the queue transporting the data of this accessor. Useful for bursty push-type
+     *  variables where the default queue length (see Application::setDefaultQueueLength()) would result in data
+     *  loss. If several accessors of the same network request a length, the maximum is used. A request below the
+     *  default has no effect. The length must be at least 2, 0 means no request. Must be called before the
+     *  connections are made, i.e. typically in the constructor of the owning module. */
+    void setQueueLength(size_t length) { node.setQueueLength(length); }
+
+    /** Only deliver the latest value to this input. If the input is not read fast enough, intermediate values are
+     *  dropped instead of being queued, and this is not reported as data loss. Intended for set points and status
+     *  values, where only the newest value is of interest. Only effective for push-type inputs fed by
+     *  ApplicationModules or through a fan-out, and not in testable mode. Must be called before the connections are
+     *  made. */
+    void setConflating(bool conflating = true) { node.setConflating(conflating); }
+
     /** Convert into VariableNetworkNode */
     operator VariableNetworkNode() { return node; }
     operator const VariableNetworkNode() const { return node; }
@@ -57,6 +71,9 @@ namespace ChimeraTK {
     /** Connect with other node */
     VariableNetworkNode operator>>(const VariableNetworkNode& otherNode) { return node >> otherNode; }
 
+    /** Use this accessor as a trigger which only fires on every n-th update, see VariableNetworkNode::every() */
+    PrescaledTrigger every(size_t n) const { return node.every(n); }
+
     /** Replace with other accessor */
     void replace(Derived&& other) {
       assert(static_cast<Derived*>(this)->_impl == nullptr && other._impl == nullptr);
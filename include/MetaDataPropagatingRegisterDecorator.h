@@ -30,6 +30,19 @@ namespace ChimeraTK {
      */
     std::atomic<DataValidity> lastValidity{DataValidity::ok};
 
+    /**
+     *  Propagate the meta data of a completed read operation to the owning module: update the module's version number
+     *  (only for blocking reads of push-type inputs) and the data fault counters if the validity has changed.
+     */
+    void propagateReadMetaData(EntityOwner* owner, TransferType type, bool isPushType, DataValidity validity,
+        VersionNumber versionNumber);
+
+    /**
+     *  Track changes of the validity set by the application before a write operation and return the validity to be
+     *  written to the target.
+     */
+    DataValidity propagateWriteMetaData(EntityOwner* owner, DataValidity validity);
+
     // The VariableNetworkNode needs access to _isCircularInput. It cannot be set at construction time because the network is not complete yet
     // and isCircularInput is not know at that moment.
     friend class VariableNetworkNode;
@@ -13,6 +13,8 @@
 #include <ChimeraTK/ReadAnyGroup.h>
 #include <ChimeraTK/TransferElement.h>
 
+#include <vector>
+
 namespace ChimeraTK {
 
   class ApplicationModule;
@@ -171,9 +173,42 @@ namespace ChimeraTK {
      *  ApplicationModule nor a VariableGroup, a ChimeraTK::logic_error is thrown. */
     ApplicationModule* findApplicationModule();
 
+    /** Build the flat lists of transfer elements used by readAll(), writeAll() and their variants, so these functions
+     *  no longer need to collect the accessors recursively on each call. Called by Application::run() for all
+     *  ApplicationModules and VariableGroups when entering LifeCycleState::run, after which the accessor structure
+     *  must not change anymore. Do not use in user code! */
+    void cacheAccessorLists();
+
    protected:
     /** Owner of this instance */
     EntityOwner* _owner{nullptr};
+
+   private:
+    /** Transfer element in the AccessorLists, with a flag whether it is used as a return channel (i.e. it is the
+     *  return channel of a *OutputRB or of a *InputWB). */
+    struct AccessorListEntry {
+      TransferElementAbstractor* element;
+      bool isReturnChannel;
+    };
+
+    /** Transfer elements of this module and all submodules for the use in readAll(), writeAll() etc. Each list keeps
+     *  the order of getAccessorListRecursive(). */
+    struct AccessorLists {
+      std::vector<AccessorListEntry> readables;     // inputs and return channels of *OutputRB
+      std::vector<AccessorListEntry> pushReadables; // push-type entries of readables
+      std::vector<TransferElementAbstractor*> pollInputs;
+      std::vector<AccessorListEntry> writables; // outputs and return channels of *InputWB
+    };
+
+    /** Collect the AccessorLists from getAccessorListRecursive(). */
+    AccessorLists makeAccessorLists() const;
+
+    /** Return the cached AccessorLists if present, otherwise fill the given buffer and return it. */
+    const AccessorLists& getAccessorLists(AccessorLists& buffer) const;
+
+    /** Cached AccessorLists, only valid if _accessorListsCached is set */
+    AccessorLists _accessorLists;
+    bool _accessorListsCached{false};
   };
 
 } /* namespace ChimeraTK */
@@ -0,0 +1,155 @@
+#ifndef CHIMERATK_MODULE_EXECUTOR_H
+#define CHIMERATK_MODULE_EXECUTOR_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <boost/thread.hpp>
+
+#include <ChimeraTK/TransferElement.h>
+
+namespace ChimeraTK {
+
+  class ModuleExecutor;
+
+  /********************************************************************************************************************/
+
+  /** Interface for entities which are executed by a ModuleExecutor instead of running their own thread. */
+  class ExecutorClient {
+   public:
+    ExecutorClient() = default;
+
+    /** The pending notification counter belongs to the executor and is not transferred. Moving is only allowed
+     *  before the client has been added to an executor. */
+    ExecutorClient(ExecutorClient&&) {}
+    ExecutorClient& operator=(ExecutorClient&&) { return *this; }
+
+    virtual ~ExecutorClient() = default;
+
+    /** Return the queues which shall trigger a call to processUpdates() when they receive data. This is called
+     *  exactly once by the executor in ModuleExecutor::start(). */
+    virtual std::vector<cppext::future_queue<void>> getNotificationQueues() = 0;
+
+    /** Process all data which is currently available. This function must not block waiting for new data, as it is
+     *  executed in one of the worker threads of the executor. It is never executed concurrently for the same client.
+     *  processUpdates() is called once directly after start of the executor (even without notification), and after
+     *  that each time one of the notification queues has received data. */
+    virtual void processUpdates() = 0;
+
+   private:
+    friend class ModuleExecutor;
+
+    /** Number of notifications received by the dispatcher but not yet processed. The client is scheduled for
+     *  execution when this counter is incremented from 0, and the worker keeps processing until it drops to 0 again.
+     *  This guarantees that the client is never executed by two workers at the same time. */
+    std::atomic<size_t> _pendingNotifications{0};
+  };
+
+  /********************************************************************************************************************/
+
+  /** Fixed-size pool of worker threads executing ExecutorClients. A single dispatcher thread waits for
+   *  notifications on the queues of all clients (like a ReadAnyGroup spanning all clients) and schedules the affected
+   *  client on the worker pool. Each worker has its own job queue, idle workers steal jobs from the other workers.
+   *
+   *  All clients must be added before start() is called. */
+  class ModuleExecutor {
+   public:
+    ~ModuleExecutor();
+
+    /** Add a client to the executor. Must be called before start(). */
+    void addClient(ExecutorClient* client);
+
+    /** Start the dispatcher and the worker threads. If nThreads is 0, one worker per CPU core is used. The name is
+     *  used to name the threads. Does nothing if no client has been added. */
+    void start(size_t nThreads, const std::string& name);
+
+    /** Schedule the client for execution as if one of its notification queues had received data. This can be called
+     *  from any thread. If it is called before start(), the client is executed by the initial processing in start().
+     *  After stop() it does nothing. */
+    void schedule(ExecutorClient* client);
+
+    /** Stop all threads. After this function has returned, no client is executed any longer. */
+    void stop();
+
+    /** Check whether the executor threads have been started. */
+    bool isRunning() const { return _dispatcherThread.joinable(); }
+
+    /** Return the number of worker threads */
+    size_t getNumberOfThreads() const { return _workers.size(); }
+
+   protected:
+    /** Per-worker job queue */
+    struct Worker {
+      std::mutex mutex;
+      std::deque<ExecutorClient*> jobs;
+      boost::thread thread;
+    };
+
+    /** Put the client into the job queue of one of the workers and wake up a worker. */
+    void post(ExecutorClient* client);
+
+    /** Take a job from the own queue or, if empty, steal one from the other workers. Returns nullptr if no job was
+     *  found. */
+    ExecutorClient* takeJob(size_t workerIndex);
+
+    /** Execute the client until all pending notifications have been processed. */
+    void execute(ExecutorClient* client);
+
+    /** Function executed in the worker threads */
+    void workerLoop(size_t workerIndex);
+
+    /** Function executed in the dispatcher thread */
+    void dispatcherLoop();
+
+    /** List of clients, filled by addClient() */
+    std::vector<ExecutorClient*> _clients;
+
+    /** Map of the indices in the _notificationQueue to the clients. Index 0 is the _wakeupQueue and maps to nullptr. */
+    std::vector<ExecutorClient*> _queueOwners;
+
+    /** Queue used to wake up the dispatcher thread on stop() */
+    cppext::future_queue<void> _wakeupQueue{1};
+
+    /** Notification queue obtained from cppext::when_any() for the queues of all clients */
+    cppext::future_queue<size_t> _notificationQueue{1};
+
+    /** Worker threads and their job queues */
+    std::vector<std::unique_ptr<Worker>> _workers;
+
+    /** Thread waiting on the _notificationQueue */
+    boost::thread _dispatcherThread;
+
+    /** Mutex and condition variable used to let idle workers sleep. Both _nJobs and _stop are only modified while
+     *  holding the mutex. */
+    std::mutex _idleMutex;
+    std::condition_variable _idleCondition;
+
+    /** Number of jobs in all worker queues which have not yet been claimed by a worker */
+    size_t _nJobs{0};
+
+    /** Flag requesting the threads to terminate */
+    std::atomic<bool> _stop{false};
+
+    /** Mutex protecting _acceptSchedule. It is held by schedule() while posting, so stop() cannot remove the workers
+     *  in the meantime. */
+    std::mutex _scheduleMutex;
+
+    /** Flag whether schedule() shall post the client. Set in start() before the initial processing of the clients is
+     *  posted and cleared in stop(). */
+    bool _acceptSchedule{false};
+
+    /** Index of the worker which receives the next job posted by the dispatcher */
+    size_t _nextWorker{0};
+
+    /** Name prefix of the threads */
+    std::string _name;
+  };
+
+} // namespace ChimeraTK
+
+#endif // CHIMERATK_MODULE_EXECUTOR_H
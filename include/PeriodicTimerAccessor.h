@@ -0,0 +1,96 @@
+#ifndef CHIMERATK_PERIODIC_TIMER_ACCESSOR_H
+#define CHIMERATK_PERIODIC_TIMER_ACCESSOR_H
+
+#include <boost/chrono.hpp>
+#include <boost/thread.hpp>
+
+#include <ChimeraTK/NDRegisterAccessor.h>
+
+#include "Application.h"
+
+namespace ChimeraTK {
+
+  /** Implementation of the NDRegisterAccessor acting as a periodic trigger source, see
+   *  VariableNetworkNode::makeTimer(). It is a poll-type accessor: read() blocks until the next period has elapsed and
+   *  then delivers the number of periods elapsed since the epoch, together with a new version number.
+   *
+   *  The deadlines are absolute (epoch + n * period), so the period does not drift with the time spent by the caller
+   *  between two reads. If the caller is late by more than one period, the missed ticks are skipped instead of being
+   *  delivered in a burst. All instances created with the same epoch and period tick in phase.
+   *
+   *  The first read returns immediately, as it provides the initial value. In testable mode, the timer never fires
+   *  after the initial value, since wall-clock ticks cannot be controlled by the test. The waiting read then releases
+   *  the testable mode lock. */
+  template<typename UserType>
+  class PeriodicTimerAccessor : public ChimeraTK::NDRegisterAccessor<UserType> {
+   public:
+    PeriodicTimerAccessor(const std::string& name, boost::chrono::nanoseconds period,
+        boost::chrono::steady_clock::time_point epoch)
+    : ChimeraTK::NDRegisterAccessor<UserType>(name, {}, "", "Periodic timer"), _period(period), _epoch(epoch) {
+      assert(_period.count() > 0);
+      ChimeraTK::NDRegisterAccessor<UserType>::buffer_2D.resize(1);
+      ChimeraTK::NDRegisterAccessor<UserType>::buffer_2D[0].resize(1);
+    }
+
+    void doReadTransferSynchronously() override {
+      auto now = boost::chrono::steady_clock::now();
+      if(_firstRead) {
+        _firstRead = false;
+        _tick = (now - _epoch) / _period;
+        return;
+      }
+
+      if(Application::getInstance().isTestableModeEnabled()) {
+        Application::testableModeUnlock("PeriodicTimer");
+        while(true) boost::this_thread::sleep_for(boost::chrono::hours(1));
+      }
+
+      ++_tick;
+      // skip missed ticks, but fire immediately for the latest one
+      auto elapsed = uint64_t((now - _epoch) / _period);
+      if(elapsed > _tick) _tick = elapsed;
+
+      // sleep_until() is an interruption point, which is used to terminate the TriggerFanOut
+      boost::this_thread::sleep_until(_epoch + _period * int64_t(_tick));
+    }
+
+    void doPostRead(TransferType, bool hasNewData) override {
+      if(!hasNewData) return;
+      ChimeraTK::NDRegisterAccessor<UserType>::buffer_2D[0][0] = userTypeToUserType<UserType>(_tick);
+      this->_versionNumber = {};
+      this->_dataValidity = DataValidity::ok;
+    }
+
+    void doPreWrite(TransferType, VersionNumber) override {
+      throw ChimeraTK::logic_error("Write operation called on read-only variable.");
+    }
+
+    bool doWriteTransfer(ChimeraTK::VersionNumber) override { return false; }
+
+    bool mayReplaceOther(const boost::shared_ptr<ChimeraTK::TransferElement const>&) const override { return false; }
+
+    bool isReadOnly() const override { return true; }
+
+    bool isReadable() const override { return true; }
+
+    bool isWriteable() const override { return false; }
+
+    std::vector<boost::shared_ptr<ChimeraTK::TransferElement>> getHardwareAccessingElements() override { return {}; }
+
+    void replaceTransferElement(boost::shared_ptr<ChimeraTK::TransferElement>) override {}
+
+    std::list<boost::shared_ptr<ChimeraTK::TransferElement>> getInternalElements() override { return {}; }
+
+   protected:
+    boost::chrono::nanoseconds _period;
+    boost::chrono::steady_clock::time_point _epoch;
+
+    /** Number of periods elapsed since the epoch at the last tick */
+    uint64_t _tick{0};
+
+    bool _firstRead{true};
+  };
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_PERIODIC_TIMER_ACCESSOR_H */
@@ -0,0 +1,66 @@
+#ifndef CHIMERATK_POOLED_APPLICATION_MODULE_H
+#define CHIMERATK_POOLED_APPLICATION_MODULE_H
+
+#include <atomic>
+#include <vector>
+
+#include "ApplicationModule.h"
+#include "ModuleExecutor.h"
+
+namespace ChimeraTK {
+
+  /** ApplicationModule which reacts on updates of its push-type inputs and hence does not need its own thread.
+   *  Instead of mainLoop(), the user implements onUpdate(), which is called each time one of the push-type inputs
+   *  (or return channels of outputs) has received new data.
+   *
+   *  If the pooled execution has been enabled with Application::enableModuleExecutor(), the module is executed by the
+   *  shared worker pool of the application. Otherwise, and always in testable mode, the module runs in its own thread
+   *  like any other ApplicationModule. In both cases onUpdate() is never called concurrently for the same module.
+   *
+   *  Since the worker threads are shared with other modules, onUpdate() must not block for a longer time. In
+   *  particular, it must not call read() on push-type inputs. Reading poll-type inputs is allowed. Note that with the
+   *  pooled execution updates of different inputs are not necessarily processed in the order of their arrival. */
+  class PooledApplicationModule : public ApplicationModule, public ExecutorClient {
+   public:
+    using ApplicationModule::ApplicationModule;
+
+    /** To be implemented by the user: function called when the given push-type input has received new data. */
+    virtual void onUpdate(TransferElementID change) = 0;
+
+    /** Can be implemented by the user: function called once after the initial values of all inputs have been
+     *  received, before onUpdate() is called for the first time. In pooled mode, the initial values are read and
+     *  onStart() is called in a startup thread of the module, so neither blocks the worker threads. */
+    virtual void onStart() {}
+
+    void run() override;
+
+   protected:
+    /** Used when running in a dedicated thread */
+    void mainLoop() final;
+
+    std::vector<cppext::future_queue<void>> getNotificationQueues() override;
+
+    void processUpdates() override;
+
+    /** Function executed in the moduleThread in pooled mode: read the initial values, call onStart() and then hand
+     *  the module over to the pool. Like in ApplicationModule::mainLoopWrapper(), the reads block until the initial
+     *  values are available, which must not happen in the shared worker threads. */
+    void startupWrapper();
+
+    /** Push-type elements observed in pooled mode and whether they are inputs (as opposed to return channels) */
+    struct PushInput {
+      VariableNetworkNode node;
+      bool isInput;
+    };
+    std::vector<PushInput> _pushInputs;
+
+    /** Poll-type inputs, which need to be read once to obtain the initial value */
+    std::vector<VariableNetworkNode> _pollInputs;
+
+    /** Flag whether all initial values have been received and onStart() has been called */
+    std::atomic<bool> _started{false};
+  };
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_POOLED_APPLICATION_MODULE_H */
@@ -0,0 +1,60 @@
+#ifndef CHIMERATK_RECONNECT_POLICY_H
+#define CHIMERATK_RECONNECT_POLICY_H
+
+#include <chrono>
+#include <string>
+
+#include <ChimeraTK/Exception.h>
+
+namespace ChimeraTK {
+
+  /**
+   *  Timing of the attempts to open a device by the DeviceModule, both at startup and when recovering from an
+   *  exception.
+   *
+   *  The first attempt at startup is made after initialDelay. Each failed attempt increases the delay: the first retry
+   *  is made after retryDelay, each further retry after the previous delay multiplied by backoffFactor, but not
+   *  longer than maxDelay. After a successful recovery the sequence starts again with retryDelay. Each delay is
+   *  varied randomly by the relative amount given by jitter, so many devices failing at the same time do not retry
+   *  in lockstep.
+   *
+   *  The default retries every 500 ms without backoff and jitter.
+   */
+  struct ReconnectPolicy {
+    /** Delay before the very first attempt to open the device */
+    std::chrono::milliseconds initialDelay{0};
+
+    /** Delay before the first retry after a failure. Must be at least 1 ms, so a failing device is not retried in a
+     *  busy loop. */
+    std::chrono::milliseconds retryDelay{500};
+
+    /** Factor to increase the delay with each further failed attempt. 1 means a constant delay. */
+    double backoffFactor{1.};
+
+    /** Upper limit for the delay */
+    std::chrono::milliseconds maxDelay{500};
+
+    /** Relative random variation of the delays, e.g. 0.1 for +-10% */
+    double jitter{0.};
+
+    /** Throw a ChimeraTK::logic_error if the policy is not valid. The name is used in the error message. */
+    void check(const std::string& name) const {
+      if(initialDelay.count() < 0 || maxDelay < retryDelay) {
+        throw ChimeraTK::logic_error(
+            name + ": The delays must not be negative and maxDelay must not be smaller than retryDelay.");
+      }
+      if(retryDelay.count() <= 0) {
+        throw ChimeraTK::logic_error(name + ": The retryDelay must be at least 1 ms.");
+      }
+      if(backoffFactor < 1.) {
+        throw ChimeraTK::logic_error(name + ": The backoffFactor must not be smaller than 1.");
+      }
+      if(jitter < 0. || jitter >= 1.) {
+        throw ChimeraTK::logic_error(name + ": The jitter must be in the range [0, 1).");
+      }
+    }
+  };
+
+} /* namespace ChimeraTK */
+
+#endif // CHIMERATK_RECONNECT_POLICY_H
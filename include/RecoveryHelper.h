@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+
 #include <ChimeraTK/TransferElement.h>
 
 namespace ChimeraTK {
@@ -14,6 +16,10 @@ namespace ChimeraTK {
     uint64_t writeOrder;
     bool wasWritten{false};
 
+    /** Optional function called by the DeviceModule before writing the accessor during a recovery. It can be used to
+     *  fill the user buffer of the accessor only when actually needed. */
+    std::function<void()> materialise;
+
     RecoveryHelper(boost::shared_ptr<TransferElement> a, VersionNumber v = VersionNumber(nullptr), uint64_t order = 0)
     : accessor(a), versionNumber(v), writeOrder(order) {}
   };
@@ -0,0 +1,182 @@
+#ifndef CHIMERATK_SPSC_ACCESSOR_H
+#define CHIMERATK_SPSC_ACCESSOR_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+
+#include <ChimeraTK/NDRegisterAccessor.h>
+
+#include "TransportSlot.h"
+
+namespace ChimeraTK {
+
+  namespace detail {
+
+    /** Shared state of a sender/receiver pair of SpscAccessors.
+     *
+     *  The data is transported through a preallocated single-producer single-consumer ring buffer of TransportSlots,
+     *  so no memory is allocated after construction and scalars are kept inline. If the ring is full, the sender
+     *  writes into an overflow slot instead, which is realised as a triple buffer (like the ConflatingBuffer). Further
+     *  writes replace the value in the overflow slot until the receiver has taken it, so the latest value is never
+     *  lost (same behaviour as a full cppext::future_queue with push_overwrite()). */
+    template<typename UserType>
+    struct SpscBuffer {
+      SpscBuffer(size_t nElements, size_t length) : nElements(nElements), ring(length) {
+        for(auto& slot : ring) slot.allocate(nElements);
+        for(auto& slot : overflow) slot.allocate(nElements);
+        notifications = cppext::future_queue<void>(length + 2);
+      }
+
+      using Slot = TransportSlot<UserType>;
+
+      size_t nElements;
+
+      /** The ring buffer. The indices are incremented monotonically, the slot index is obtained modulo the length. */
+      std::vector<Slot> ring;
+      std::atomic<size_t> head{0}; // written only by the sender
+      std::atomic<size_t> tail{0}; // written only by the receiver
+
+      /** Overflow triple buffer. overflowMiddle holds the index of the slot not owned by either side, combined with the
+       *  newDataBit if it holds a value not yet taken by the receiver. */
+      std::array<Slot, 3> overflow;
+      std::atomic<unsigned int> overflowMiddle{1};
+      static constexpr unsigned int newDataBit{4};
+
+      /** One element is pushed for each value in the ring and for each time the overflow slot becomes occupied, so the
+       *  number of pending notifications always matches the number of values available. One spare element is
+       *  reserved for the exception pushed by interrupt(). */
+      cppext::future_queue<void> notifications{2};
+    };
+
+  } // namespace detail
+
+  /********************************************************************************************************************/
+
+  /** Lean implementation of a push-type process variable for direct 1:1 connections between ApplicationModules. It
+   *  has the same semantics as the synchronised ProcessArray pair from the ControlSystemAdapter (including data loss
+   *  reporting if the queue is full), but carries version number and data validity inside the preallocated ring
+   *  slots, without persistence or other features only needed for control system variables.
+   *
+   *  Use createSpscVariable() to create a connected sender/receiver pair. */
+  template<typename UserType>
+  class SpscAccessor : public ChimeraTK::NDRegisterAccessor<UserType> {
+   public:
+    SpscAccessor(boost::shared_ptr<detail::SpscBuffer<UserType>> buffer, bool isSender, const std::string& name,
+        const std::string& unit, const std::string& description)
+    : ChimeraTK::NDRegisterAccessor<UserType>(name, {AccessMode::wait_for_new_data}, unit, description),
+      _buffer(buffer), _isSender(isSender), _ownOverflowSlot(isSender ? 0 : 2) {
+      ChimeraTK::NDRegisterAccessor<UserType>::buffer_2D.resize(1);
+      ChimeraTK::NDRegisterAccessor<UserType>::buffer_2D[0].resize(_buffer->nElements);
+      if(!_isSender) this->_readQueue = _buffer->notifications;
+    }
+
+    void doReadTransferSynchronously() override {}
+
+    void doPreRead(TransferType) override {
+      if(_isSender) throw ChimeraTK::logic_error("Read operation called on write-only variable.");
+    }
+
+    void doPostRead(TransferType, bool hasNewData) override {
+      if(!hasNewData) return;
+      auto& buf = *_buffer;
+      auto tail = buf.tail.load(std::memory_order_relaxed);
+      if(tail != buf.head.load(std::memory_order_acquire)) {
+        take(buf.ring[tail % buf.ring.size()]);
+        buf.tail.store(tail + 1, std::memory_order_release);
+      }
+      else {
+        auto index = buf.overflowMiddle.exchange(_ownOverflowSlot, std::memory_order_acq_rel);
+        assert(index & detail::SpscBuffer<UserType>::newDataBit);
+        _ownOverflowSlot = index & ~detail::SpscBuffer<UserType>::newDataBit;
+        take(buf.overflow[_ownOverflowSlot]);
+      }
+    }
+
+    void doPreWrite(TransferType, VersionNumber) override {
+      if(!_isSender) throw ChimeraTK::logic_error("Write operation called on read-only variable.");
+    }
+
+    bool doWriteTransfer(ChimeraTK::VersionNumber versionNumber) override { return push(versionNumber, false); }
+
+    bool doWriteTransferDestructively(ChimeraTK::VersionNumber versionNumber) override {
+      return push(versionNumber, true);
+    }
+
+    bool mayReplaceOther(const boost::shared_ptr<ChimeraTK::TransferElement const>&) const override { return false; }
+
+    bool isReadOnly() const override { return !_isSender; }
+
+    bool isReadable() const override { return !_isSender; }
+
+    bool isWriteable() const override { return _isSender; }
+
+    std::vector<boost::shared_ptr<ChimeraTK::TransferElement>> getHardwareAccessingElements() override { return {}; }
+
+    void replaceTransferElement(boost::shared_ptr<ChimeraTK::TransferElement>) override {}
+
+    std::list<boost::shared_ptr<ChimeraTK::TransferElement>> getInternalElements() override { return {}; }
+
+    void interrupt() override {
+      if(!_isSender) TransferElement::interrupt_impl(this->_readQueue);
+    }
+
+   protected:
+    using Slot = typename detail::SpscBuffer<UserType>::Slot;
+
+    /** Receiver: move the slot content into the user buffer */
+    void take(Slot& slot) {
+      slot.take(ChimeraTK::NDRegisterAccessor<UserType>::buffer_2D[0], this->_versionNumber, this->_dataValidity);
+    }
+
+    /** Sender: fill the slot from the user buffer */
+    void fill(Slot& slot, ChimeraTK::VersionNumber versionNumber, bool destructive) {
+      slot.fill(ChimeraTK::NDRegisterAccessor<UserType>::buffer_2D[0], versionNumber, this->_dataValidity, destructive);
+    }
+
+    /** Sender: send the value, returns true if a previous value has been overwritten */
+    bool push(ChimeraTK::VersionNumber versionNumber, bool destructive) {
+      auto& buf = *_buffer;
+      auto head = buf.head.load(std::memory_order_relaxed);
+      // Values must not be put into the ring while the overflow slot is occupied, as this would change the order.
+      bool overflowOccupied =
+          buf.overflowMiddle.load(std::memory_order_acquire) & detail::SpscBuffer<UserType>::newDataBit;
+      if(!overflowOccupied && head - buf.tail.load(std::memory_order_acquire) < buf.ring.size()) {
+        fill(buf.ring[head % buf.ring.size()], versionNumber, destructive);
+        buf.head.store(head + 1, std::memory_order_release);
+        buf.notifications.push();
+        return false;
+      }
+      fill(buf.overflow[_ownOverflowSlot], versionNumber, destructive);
+      auto previous = buf.overflowMiddle.exchange(
+          _ownOverflowSlot | detail::SpscBuffer<UserType>::newDataBit, std::memory_order_acq_rel);
+      _ownOverflowSlot = previous & ~detail::SpscBuffer<UserType>::newDataBit;
+      if(previous & detail::SpscBuffer<UserType>::newDataBit) return true;
+      buf.notifications.push();
+      return false;
+    }
+
+    boost::shared_ptr<detail::SpscBuffer<UserType>> _buffer;
+    bool _isSender;
+
+    /** Index of the overflow slot currently owned by this side */
+    unsigned int _ownOverflowSlot;
+  };
+
+  /********************************************************************************************************************/
+
+  /** Create a connected pair of SpscAccessors with the given queue length. The first element in the returned pair is
+   *  the sender, the second the receiver. */
+  template<typename UserType>
+  std::pair<boost::shared_ptr<NDRegisterAccessor<UserType>>, boost::shared_ptr<NDRegisterAccessor<UserType>>>
+      createSpscVariable(size_t nElements, const std::string& name, const std::string& unit,
+          const std::string& description, size_t length) {
+    // The overflow slot adds one element to the effective queue length
+    auto buffer = boost::make_shared<detail::SpscBuffer<UserType>>(nElements, std::max<size_t>(length, 2) - 1);
+    return {boost::make_shared<SpscAccessor<UserType>>(buffer, true, name, unit, description),
+        boost::make_shared<SpscAccessor<UserType>>(buffer, false, name, unit, description)};
+  }
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_SPSC_ACCESSOR_H */
@@ -0,0 +1,59 @@
+#ifndef CHIMERATK_STARTUP_PROFILE_H
+#define CHIMERATK_STARTUP_PROFILE_H
+
+#include <chrono>
+#include <iostream>
+#include <list>
+#include <mutex>
+#include <string>
+
+#include <boost/shared_ptr.hpp>
+
+#include <ChimeraTK/ControlSystemAdapter/DevicePVManager.h>
+
+namespace ChimeraTK {
+
+  /** Durations of the startup phases of the application. The phases are recorded by Application::initialise() and
+   *  Application::run(), by the DeviceModules when the device is opened and initialised for the first time, and by
+   *  the ApplicationModules when they enter their main loop. Phases may be recorded from different threads.
+   *
+   *  See Application::printStartupProfile() and Application::publishStartupProfile(). */
+  class StartupProfile {
+   public:
+    /** Record the duration of the given phase. Phase names are hierarchical, e.g. "initialise/makeConnections". Since
+     *  each phase becomes a process variable, a phase must not have sub-phases; the duration of a phase with sub-phases
+     *  is recorded as e.g. "initialise/total". If the phase has been recorded before, the duration is replaced. */
+    void record(const std::string& phase, std::chrono::steady_clock::duration duration);
+
+    /** Declare a phase which will be recorded later, so its process variable can be created in advance. */
+    void declare(const std::string& phase);
+
+    /** Publish all phases as process variables (in milliseconds) below the given path. The process variables are
+     *  created for all phases recorded or declared so far. Phases recorded later but not declared are not published.
+     */
+    void publish(const boost::shared_ptr<DevicePVManager>& pvManager, const std::string& path);
+
+    /** Print all phases recorded so far. */
+    void print(std::ostream& stream = std::cout) const;
+
+   private:
+    struct Phase {
+      std::string name;
+      bool recorded{false};
+      double duration{0}; // in milliseconds
+      boost::shared_ptr<NDRegisterAccessor<float>> processVariable;
+    };
+
+    /** Find the phase with the given name, add it if not yet present. Must be called with the mutex held. */
+    Phase& get(const std::string& phase);
+
+    /** Write the duration into the process variable, if present. Must be called with the mutex held. */
+    void write(Phase& phase);
+
+    mutable std::mutex _mutex;
+    std::list<Phase> _phases;
+  };
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_STARTUP_PROFILE_H */
@@ -0,0 +1,45 @@
+#ifndef CHIMERATK_TAG_INDEX_H
+#define CHIMERATK_TAG_INDEX_H
+
+#include <string>
+
+#include <boost/dynamic_bitset.hpp>
+
+namespace ChimeraTK {
+
+  /** Process-wide index of interned tags. Each distinct tag string is assigned a small integer ID, so the tags of a
+   *  VariableNetworkNode can be stored as a bitset of IDs in addition to the strings. Tag expressions passed to
+   *  EntityOwner::findTag() are resolved into a TagIndex::Match once, matching each distinct tag at most once against
+   *  the regular expression, instead of evaluating the expression for every tag of every node. */
+  class TagIndex {
+   public:
+    /** Set of tag IDs */
+    using TagSet = boost::dynamic_bitset<>;
+
+    /** Result of resolving a tag expression against all known tags */
+    struct Match {
+      /** IDs of all tags matching the expression */
+      TagSet tags;
+
+      /** Whether the expression matches the empty string, i.e. nodes without any tag */
+      bool matchesUntagged{false};
+
+      /** Check whether a node with the given set of tag IDs matches */
+      bool operator()(const TagSet& nodeTags) const;
+    };
+
+    /** Return the ID of the given tag, assigning a new ID if the tag is not yet known. */
+    static size_t intern(const std::string& tag);
+
+    /** Add the given tag to the set of tag IDs, growing the set as needed. */
+    static void addToSet(TagSet& set, const std::string& tag);
+
+    /** Resolve the given tag expression, which is interpreted as a regular expression (see std::regex_match). The
+     *  result is cached per expression. Tags interned after the expression has been resolved last are matched when
+     *  the expression is used again. Expressions without special characters are looked up directly. */
+    static Match match(const std::string& expression);
+  };
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_TAG_INDEX_H */
@@ -8,6 +8,8 @@
 #ifndef CHIMERATK_THREADED_FAN_OUT_H
 #define CHIMERATK_THREADED_FAN_OUT_H
 
+#include <algorithm>
+
 #include <ChimeraTK/NDRegisterAccessor.h>
 #include <ChimeraTK/ReadAnyGroup.h>
 
@@ -19,9 +21,12 @@ namespace ChimeraTK {
 
   /** FanOut implementation with an internal thread which waits for new data which
    * is read from the given feeding implementation and distributed to any number
-   * of slaves. */
+   * of slaves.
+   *
+   * If the fan-out dispatcher has been enabled with Application::enableFanOutDispatcher(), no thread is created.
+   * Instead the distribution is executed by the shared dispatcher of the application. */
   template<typename UserType>
-  class ThreadedFanOut : public FanOut<UserType>, public InternalModule {
+  class ThreadedFanOut : public FanOut<UserType>, public InternalModule, public ExecutorClient {
    public:
     ThreadedFanOut(boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>> feedingImpl, VariableNetwork& network,
         ConsumerImplementationPairs<UserType> const& consumerImplementationPairs)
@@ -37,6 +42,12 @@ namespace ChimeraTK {
     void activate() override {
       if(this->_disabled) return;
       assert(!_thread.joinable());
+      auto& app = Application::getInstance();
+      if(isDispatchable() && app.fanOutDispatcherEnabled && !app.isTestableModeEnabled()) {
+        testableModeReached = true;
+        app.fanOutDispatcher.addClient(this);
+        return;
+      }
       _thread = boost::thread([this] { this->run(); });
     }
 
@@ -62,16 +73,7 @@ namespace ChimeraTK {
         // send out copies to slaves
         Profiler::startMeasurement();
         boost::this_thread::interruption_point();
-        auto validity = FanOut<UserType>::impl->dataValidity();
-        for(auto& slave : FanOut<UserType>::slaves) {
-          // do not send copy if no data is expected (e.g. trigger)
-          if(slave->getNumberOfSamples() != 0) {
-            slave->accessChannel(0) = FanOut<UserType>::impl->accessChannel(0);
-          }
-          slave->setDataValidity(validity);
-          bool dataLoss = slave->writeDestructively(version);
-          if(dataLoss) Application::incrementDataLossCounter(slave->getName());
-        }
+        distribute(version);
         // receive data
         boost::this_thread::interruption_point();
         Profiler::stopMeasurement();
@@ -80,6 +82,31 @@ namespace ChimeraTK {
       }
     }
 
+    /** Send the current value of the feeder to all slaves. The content of the feeder's buffer is no longer needed
+     *  afterwards (it will be overwritten by the next read), so the last slave receiving data gets the buffer by swap
+     *  and only the other slaves need a copy. */
+    void distribute(VersionNumber version) {
+      auto validity = FanOut<UserType>::impl->dataValidity();
+      auto& feederBuffer = FanOut<UserType>::impl->accessChannel(0);
+      auto lastDataSlave = std::find_if(FanOut<UserType>::slaves.rbegin(), FanOut<UserType>::slaves.rend(),
+          [](auto& slave) { return slave->getNumberOfSamples() != 0; });
+      for(auto& slave : FanOut<UserType>::slaves) {
+        // do not send copy if no data is expected (e.g. trigger)
+        if(slave->getNumberOfSamples() != 0) {
+          // Swapping requires the slave's buffer to have the right size, since it becomes the buffer of the feeder.
+          if(slave == *lastDataSlave && slave->accessChannel(0).size() == feederBuffer.size()) {
+            slave->accessChannel(0).swap(feederBuffer);
+          }
+          else {
+            slave->accessChannel(0) = feederBuffer;
+          }
+        }
+        slave->setDataValidity(validity);
+        bool dataLoss = slave->writeDestructively(version);
+        if(dataLoss) Application::incrementDataLossCounter(slave->getName());
+      }
+    }
+
     VersionNumber readInitialValues() {
       Application::testableModeUnlock("readInitialValues");
       FanOut<UserType>::impl->read();
@@ -90,6 +117,21 @@ namespace ChimeraTK {
     }
 
    protected:
+    /** Whether this fan-out can be executed by the fan-out dispatcher instead of its own thread */
+    virtual bool isDispatchable() const { return true; }
+
+    std::vector<cppext::future_queue<void>> getNotificationQueues() override {
+      return {FanOut<UserType>::impl->getReadQueue()};
+    }
+
+    /** Executed by the fan-out dispatcher. The first value received is the initial value, hence no special treatment
+     *  is required compared to run(). */
+    void processUpdates() override {
+      while(FanOut<UserType>::impl->readNonBlocking()) {
+        distribute(FanOut<UserType>::impl->getVersionNumber());
+      }
+    }
+
     /** Thread handling the synchronisation, if needed */
     boost::thread _thread;
 
@@ -172,6 +214,9 @@ namespace ChimeraTK {
     }
 
    protected:
+    /** The return channel requires reading two elements, which is not supported by the fan-out dispatcher */
+    bool isDispatchable() const override { return false; }
+
     /** Thread handling the synchronisation, if needed */
     boost::thread _thread;
 
@@ -0,0 +1,67 @@
+#ifndef CHIMERATK_TRANSPORT_SLOT_H
+#define CHIMERATK_TRANSPORT_SLOT_H
+
+#include <utility>
+#include <vector>
+
+#include <ChimeraTK/TransferElement.h>
+
+namespace ChimeraTK {
+  namespace detail {
+
+  /** Preallocated slot of the lock-free transports (ConflatingAccessor, SpscAccessor), holding one value together with
+   *  its version number and data validity.
+   *
+   *  Scalars are stored inline in the slot, so transporting them does not touch any heap-allocated vector. Arrays are
+   *  exchanged with the user buffer by swapping where possible, so no memory is allocated after construction. */
+  template<typename UserType>
+  struct TransportSlot {
+    /** Prepare the slot for values with nElements elements */
+    void allocate(size_t nElements) {
+      if(nElements != 1) value.resize(nElements);
+    }
+
+    /** Sender: fill the slot from the user buffer. The user buffer is left intact unless destructive is set. */
+    void fill(std::vector<UserType>& userBuffer, VersionNumber versionNumber, DataValidity dataValidity,
+        bool destructive) {
+      if(userBuffer.size() == 1) {
+        if(destructive) {
+          std::swap(scalar, userBuffer[0]);
+        }
+        else {
+          scalar = userBuffer[0];
+        }
+      }
+      else if(destructive) {
+        value.swap(userBuffer);
+      }
+      else {
+        // same size, so no allocation
+        value = userBuffer;
+      }
+      version = versionNumber;
+      validity = dataValidity;
+    }
+
+    /** Receiver: move the slot content into the user buffer */
+    void take(std::vector<UserType>& userBuffer, VersionNumber& versionNumber, DataValidity& dataValidity) {
+      if(userBuffer.size() == 1) {
+        std::swap(userBuffer[0], scalar);
+      }
+      else {
+        userBuffer.swap(value);
+      }
+      versionNumber = version;
+      dataValidity = validity;
+    }
+
+    std::vector<UserType> value;
+    UserType scalar{};
+    VersionNumber version{nullptr};
+    DataValidity validity{DataValidity::ok};
+  };
+
+  } // namespace detail
+} // namespace ChimeraTK
+
+#endif // CHIMERATK_TRANSPORT_SLOT_H
@@ -8,6 +8,9 @@
 #ifndef CHIMERATK_TRIGGER_FAN_OUT_H
 #define CHIMERATK_TRIGGER_FAN_OUT_H
 
+#include <algorithm>
+#include <list>
+
 #include <ChimeraTK/NDRegisterAccessor.h>
 #include <ChimeraTK/SupportedUserTypes.h>
 #include <ChimeraTK/TransferGroup.h>
@@ -34,6 +37,10 @@ namespace ChimeraTK {
 
     void activate() override {
       assert(!_thread.joinable());
+      _pipelined = Application::getInstance().triggerPipeliningEnabled && !Application::getInstance().testableMode;
+      if(_pipelined) {
+        _distributionThread = boost::thread([this] { this->distribute(); });
+      }
       _thread = boost::thread([this] { this->run(); });
     }
 
@@ -45,26 +52,41 @@ namespace ChimeraTK {
         }
         _thread.join();
       }
+      if(_distributionThread.joinable()) {
+        _distributionThread.interrupt();
+        _distributionThread.join();
+      }
       assert(!_thread.joinable());
     }
 
     /** Add a new network the TriggerFanOut. The network is defined by its feeding
      * node. This function will return the corresponding FeedingFanOut, to which
-     * all slaves have to be added. */
+     * all slaves have to be added. The feeder is read only on every n-th trigger, where n is the given prescaler
+     * (see VariableNetworkNode::every()). */
     template<typename UserType>
     boost::shared_ptr<FeedingFanOut<UserType>> addNetwork(
         boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>> feedingNode,
-        ConsumerImplementationPairs<UserType> const& consumerImplementationPairs) {
+        ConsumerImplementationPairs<UserType> const& consumerImplementationPairs, size_t prescaler = 1) {
       assert(feedingNode.get() != nullptr);
-      transferGroup.addAccessor(feedingNode);
+      assert(prescaler > 0);
+      auto group = std::find_if(
+          readGroups.begin(), readGroups.end(), [&](const ReadGroup& g) { return g.prescaler == prescaler; });
+      if(group == readGroups.end()) {
+        readGroups.emplace_back(prescaler);
+        group = std::prev(readGroups.end());
+      }
+      group->transferGroup.addAccessor(feedingNode);
       auto feedingFanOut = boost::make_shared<FeedingFanOut<UserType>>(feedingNode->getName(), feedingNode->getUnit(),
           feedingNode->getDescription(), feedingNode->getNumberOfSamples(),
           false, // in TriggerFanOuts we cannot have return channels
           consumerImplementationPairs);
-      boost::fusion::at_key<UserType>(fanOutMap.table)[feedingNode] = feedingFanOut;
+      boost::fusion::at_key<UserType>(group->fanOutMap.table)[feedingNode] = feedingFanOut;
       return feedingFanOut;
     }
 
+    /** Return the DeviceModule of the device all networks of this TriggerFanOut are read from */
+    const DeviceModule& getDeviceModule() const { return _deviceModule; }
+
     /** Synchronise feeder and the consumers. This function is executed in the
      * separate thread. */
     void run() {
@@ -88,10 +110,37 @@ namespace ChimeraTK {
       Application::testableModeLock("Enter while loop");
       if(Application::getInstance().testableMode) --Application::getInstance().testableMode_deviceInitialisationCounter;
 
+      // Number of triggers received so far. All groups are read on the first trigger, so every feeder provides its
+      // initial value.
+      size_t tick = 0;
+      auto isDue = [&](const ReadGroup& group) { return tick % group.prescaler == 0; };
+
       while(true) {
-        transferGroup.read();
-        // send the version number to the consumers
-        boost::fusion::for_each(fanOutMap.table, SendDataToConsumers(version, externalTrigger->dataValidity()));
+        for(auto& group : readGroups) {
+          if(isDue(group)) group.transferGroup.read();
+        }
+        if(!_pipelined) {
+          // send the version number to the consumers
+          for(auto& group : readGroups) {
+            if(!isDue(group)) continue;
+            boost::fusion::for_each(
+                group.fanOutMap.table, SendDataToConsumers(version, externalTrigger->dataValidity()));
+          }
+        }
+        else {
+          // Wait until the data of the previous trigger has been distributed, then hand the new data over to the
+          // distribution thread. The feeders keep their data (see SendDataToConsumers).
+          boost::unique_lock<boost::mutex> lock(_pipelineMutex);
+          while(_distributionPending) _pipelineCondition.wait(lock);
+          for(auto& group : readGroups) {
+            group.distribute = isDue(group);
+            if(!group.distribute) continue;
+            boost::fusion::for_each(group.fanOutMap.table, CopyDataToFanOuts(externalTrigger->dataValidity()));
+          }
+          _pendingVersion = version;
+          _distributionPending = true;
+          _pipelineCondition.notify_all();
+        }
 
         // wait for external trigger
         boost::this_thread::interruption_point();
@@ -100,10 +149,28 @@ namespace ChimeraTK {
         Profiler::startMeasurement();
         boost::this_thread::interruption_point();
         version = externalTrigger->getVersionNumber();
+        ++tick;
       }
     }
 
    protected:
+    /** Distribute the data handed over by run() to the consumers. Executed in the _distributionThread, only used in
+     *  pipelined mode. */
+    void distribute() {
+      Application::registerThread("TrFD" + externalTrigger->getName());
+      boost::unique_lock<boost::mutex> lock(_pipelineMutex);
+      while(true) {
+        while(!_distributionPending) _pipelineCondition.wait(lock);
+        lock.unlock();
+        for(auto& group : readGroups) {
+          if(group.distribute) boost::fusion::for_each(group.fanOutMap.table, WriteFanOuts(_pendingVersion));
+        }
+        lock.lock();
+        _distributionPending = false;
+        _pipelineCondition.notify_all();
+      }
+    }
+
     /** Functor class to send data to the consumers, suitable for
      * boost::fusion::for_each(). */
     struct SendDataToConsumers {
@@ -112,13 +179,13 @@ namespace ChimeraTK {
 
       template<typename PAIR>
       void operator()(PAIR& pair) const {
-        auto theMap = pair.second; // map of feeder to FeedingFanOut (i.e. part of
-                                   // the fanOutMap)
+        auto& theMap = pair.second; // map of feeder to FeedingFanOut (i.e. part of
+                                    // the fanOutMap), not copied to avoid allocations per trigger
 
         // iterate over all feeder/FeedingFanOut pairs
         for(auto& network : theMap) {
-          auto feeder = network.first;
-          auto fanOut = network.second;
+          auto& feeder = network.first;
+          auto& fanOut = network.second;
           fanOut->setDataValidity((_triggerValidity == DataValidity::ok && feeder->dataValidity() == DataValidity::ok) ?
                   DataValidity::ok :
                   DataValidity::faulty);
@@ -135,6 +202,42 @@ namespace ChimeraTK {
       DataValidity _triggerValidity;
     };
 
+    /** Functor class to copy the data of the feeders into the FeedingFanOuts, used in pipelined mode. The data is copied
+     *  instead of swapped, since the feeders must keep a valid copy (see SendDataToConsumers). */
+    struct CopyDataToFanOuts {
+      CopyDataToFanOuts(DataValidity triggerValidity) : _triggerValidity(triggerValidity) {}
+
+      template<typename PAIR>
+      void operator()(PAIR& pair) const {
+        for(auto& network : pair.second) {
+          auto& feeder = network.first;
+          auto& fanOut = network.second;
+          fanOut->setDataValidity((_triggerValidity == DataValidity::ok && feeder->dataValidity() == DataValidity::ok) ?
+                  DataValidity::ok :
+                  DataValidity::faulty);
+          fanOut->accessChannel(0) = feeder->accessChannel(0);
+        }
+      }
+
+      DataValidity _triggerValidity;
+    };
+
+    /** Functor class to write the FeedingFanOuts to the consumers, used in pipelined mode. */
+    struct WriteFanOuts {
+      WriteFanOuts(VersionNumber version) : _version(version) {}
+
+      template<typename PAIR>
+      void operator()(PAIR& pair) const {
+        for(auto& network : pair.second) {
+          auto& fanOut = network.second;
+          bool dataLoss = fanOut->write(_version);
+          if(dataLoss) Application::incrementDataLossCounter(fanOut->getName());
+        }
+      }
+
+      VersionNumber _version;
+    };
+
     /** TransferElement acting as our trigger */
     boost::shared_ptr<ChimeraTK::TransferElement> externalTrigger;
 
@@ -143,14 +246,45 @@ namespace ChimeraTK {
     template<typename UserType>
     using FanOutMap = std::map<boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>>,
         boost::shared_ptr<FeedingFanOut<UserType>>>;
-    TemplateUserTypeMap<FanOutMap> fanOutMap;
 
-    /** TransferGroup containing all feeders NDRegisterAccessors */
-    ChimeraTK::TransferGroup transferGroup;
+    /** Feeders read with the same trigger prescaler */
+    struct ReadGroup {
+      explicit ReadGroup(size_t prescaler_) : prescaler(prescaler_) {}
+
+      /** The feeders are read on every prescaler-th trigger */
+      size_t prescaler;
+
+      /** TransferGroup containing the feeders NDRegisterAccessors. All feeders belong to the same device, so the
+       *  TransferGroup can merge adjacent or overlapping registers into a single block transfer and scatter the data
+       *  into the individual feeders afterwards, independent of their user types. */
+      ChimeraTK::TransferGroup transferGroup;
+
+      /** FeedingFanOuts of the feeders */
+      TemplateUserTypeMap<FanOutMap> fanOutMap;
+
+      /** Flag whether the group is part of the pending distribution in pipelined mode. Protected by _pipelineMutex. */
+      bool distribute{false};
+    };
+
+    /** The read groups, one per prescaler. All groups are read in the same thread. */
+    std::list<ReadGroup> readGroups;
 
     /** Thread handling the synchronisation, if needed */
     boost::thread _thread;
 
+    /** Flag whether the data is distributed in the _distributionThread, see Application::enableTriggerPipelining() */
+    bool _pipelined{false};
+
+    /** Thread distributing the data in pipelined mode */
+    boost::thread _distributionThread;
+
+    /** Hand-over between run() and distribute() in pipelined mode. _distributionPending is set while the
+     *  FeedingFanOuts contain data which has not yet been written. */
+    boost::mutex _pipelineMutex;
+    boost::condition_variable _pipelineCondition;
+    bool _distributionPending{false};
+    VersionNumber _pendingVersion{nullptr};
+
     /** The DeviceModule of the feeder. Required for exception handling */
     DeviceModule& _deviceModule;
 
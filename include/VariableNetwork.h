@@ -81,6 +81,10 @@ namespace ChimeraTK {
     /** Check whether the network has a consuming application node */
     bool hasApplicationConsumer() const;
 
+    /** Return the length of the queues used to realise this network. This is the maximum of the lengths requested
+     *  by the nodes (see VariableNetworkNode::setQueueLength()) and the application default. */
+    size_t getQueueLength() const;
+
     /** Dump the network structure to std::cout. The optional linePrefix will be
      * prepended to all lines. */
     void dump(const std::string& linePrefix = "", std::ostream& stream = std::cout) const;
@@ -8,6 +8,7 @@
 #ifndef CHIMERATK_VARIABLE_NETWORK_NODE_H
 #define CHIMERATK_VARIABLE_NETWORK_NODE_H
 
+#include <chrono>
 #include <iostream>
 #include <unordered_map>
 #include <unordered_set>
@@ -20,6 +21,7 @@
 
 #include "ConstantAccessor.h"
 #include "Flags.h"
+#include "TagIndex.h"
 #include "MetaDataPropagatingRegisterDecorator.h"
 #include "Visitor.h"
 
@@ -29,6 +31,7 @@ namespace ChimeraTK {
   class AccessorBase;
   class EntityOwner;
   struct VariableNetworkNode_data;
+  struct PrescaledTrigger;
 
   /** Pseudo type to identify nodes which can have arbitrary types */
   class AnyType {};
@@ -74,6 +77,15 @@ namespace ChimeraTK {
     template<typename UserType>
     static VariableNetworkNode makeConstant(bool makeFeeder, UserType value = 0, size_t length = 1);
 
+    /** Factory function for a periodic timer, which can be used as an external trigger in place of e.g. the tick
+     *  output of a PeriodicTrigger module. The TriggerFanOut reads the timer directly, so no module thread and no
+     *  process variable is involved. The value is the number of periods elapsed (uint64_t). Timers can only be used
+     *  as triggers. */
+    static VariableNetworkNode makeTimer(std::chrono::nanoseconds period);
+
+    /** Return the period of a Timer-type node */
+    std::chrono::nanoseconds getTimerPeriod() const;
+
     /** Change meta data (name, unit, description and optionally tags). This
      * function may only be used on Application-type nodes. If the optional
      * argument tags is omitted, the tags will not be changed. To clear the
@@ -111,6 +123,16 @@ namespace ChimeraTK {
     /** Add a trigger */
     VariableNetworkNode operator[](VariableNetworkNode trigger);
 
+    /** Add a trigger with a prescaler, see every() */
+    VariableNetworkNode operator[](const PrescaledTrigger& trigger);
+
+    /** Use this node as a trigger which only fires on every n-th update, e.g. dev("reg")[trigger.every(10)]. The
+     *  prescaler is applied directly in the TriggerFanOut reading the device, so no additional module is needed. */
+    PrescaledTrigger every(size_t n) const;
+
+    /** Return the prescaler of the external trigger (1 if no prescaler is used) */
+    size_t getTriggerPrescaler() const;
+
     /** Check for presence of an external trigger */
     bool hasExternalTrigger() const;
 
@@ -159,8 +181,26 @@ namespace ChimeraTK {
     const std::string& getDeviceAlias() const;
     const std::string& getRegisterName() const;
     const std::unordered_set<std::string>& getTags() const;
+
+    /** Return the tags as set of interned tag IDs, see TagIndex. */
+    const TagIndex::TagSet& getTagIds() const;
+
     void setNumberOfElements(size_t nElements);
     size_t getNumberOfElements() const;
+
+    /** Request a minimum length for the queue used to transport the data of this variable. The network will use the
+     *  maximum of the lengths requested by its nodes and the application-wide default (see
+     *  Application::setDefaultQueueLength()). Since the requests of all nodes are taken into account, this can also be
+     *  used on control system or device nodes to configure the entire network. 0 means no request, otherwise the
+     *  length must be at least 2. */
+    void setQueueLength(size_t length);
+    size_t getQueueLength() const;
+
+    /** Request the conflating transport for this consuming node: only the latest value is delivered and overwritten
+     *  values are not counted as data loss. See ConflatingAccessor for details. Only effective for push-type
+     *  application inputs. */
+    void setConflating(bool conflating = true);
+    bool isConflating() const;
     ChimeraTK::TransferElementAbstractor& getAppAccessorNoType() const;
 
     void setPublicName(const std::string& name) const;
@@ -195,6 +235,14 @@ namespace ChimeraTK {
 
   /*********************************************************************************************************************/
 
+  /** A trigger node together with a prescaler, created by VariableNetworkNode::every() */
+  struct PrescaledTrigger {
+    VariableNetworkNode trigger;
+    size_t prescaler;
+  };
+
+  /*********************************************************************************************************************/
+
   /** A helper class to create accessors with the right length and value. We use this
    *  to create one constant accessor for each consumer so e don't have to use a fanout: The consumers might be mixed
    *  push or poll type, and as we don't have a sender/receive pair but just one side, it has to be adapted.
@@ -243,6 +291,9 @@ namespace ChimeraTK {
     /** Pointer to instance creator if type == Constant */
     boost::shared_ptr<ConstantAccessorCreator> constNodeCreator;
 
+    /** Period if type == Timer */
+    std::chrono::nanoseconds timerPeriod{0};
+
     /** Pointer to implementation if type == Application */
     ChimeraTK::TransferElementAbstractor* appNode{nullptr};
 
@@ -254,6 +305,9 @@ namespace ChimeraTK {
      * will be converted into push. */
     VariableNetworkNode externalTrigger{nullptr};
 
+    /** The external trigger fires only on every n-th update of the trigger network, see VariableNetworkNode::every() */
+    size_t triggerPrescaler{1};
+
     /** Public name if type == ControlSystem */
     std::string publicName;
 
@@ -268,9 +322,18 @@ namespace ChimeraTK {
     /** Number of elements in the variable. 0 means not yet decided. */
     size_t nElements{0};
 
+    /** Requested length of the data transport queue. 0 means no specific request. */
+    size_t queueLength{0};
+
+    /** Flag whether the conflating transport has been requested for this node */
+    bool conflating{false};
+
     /** Set of tags  if type == Application */
     std::unordered_set<std::string> tags;
 
+    /** Interned IDs of the tags, always kept in sync with tags */
+    TagIndex::TagSet tagIds;
+
     /** Map to store triggered versions of this node. The map key is the trigger
      * node and the value is the node with the respective trigger added. */
     std::map<VariableNetworkNode, VariableNetworkNode> nodeWithTrigger;
@@ -346,6 +409,11 @@ namespace ChimeraTK {
 
   template<typename UserType>
   void VariableNetworkNode::setAppAccessorImplementation(boost::shared_ptr<NDRegisterAccessor<UserType>> impl) const {
+    // The FusedDeviceAccessorDecorator already propagates the meta data, so it must not be decorated again.
+    if(boost::dynamic_pointer_cast<MetaDataPropagationFlagProvider>(impl)) {
+      getAppAccessor<UserType>().replace(impl);
+      return;
+    }
     auto decorated = boost::make_shared<MetaDataPropagatingRegisterDecorator<UserType>>(impl, getOwningModule());
     getAppAccessor<UserType>().replace(decorated);
     auto flagProvider = boost::dynamic_pointer_cast<MetaDataPropagationFlagProvider>(decorated);
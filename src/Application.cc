@@ -5,23 +5,30 @@
  *      Author: Martin Hierholzer
  */
 
+#include <algorithm>
 #include <exception>
 #include <fstream>
 #include <string>
 #include <thread>
+#include <unordered_map>
+#include <unordered_set>
 
+#include <boost/container_hash/hash.hpp>
 #include <boost/fusion/container/map.hpp>
 #include <ChimeraTK/BackendFactory.h>
 
 #include "Application.h"
 #include "ApplicationModule.h"
 #include "ArrayAccessor.h"
+#include "ConflatingAccessor.h"
 #include "ConstantAccessor.h"
 #include "ConsumingFanOut.h"
 #include "DebugPrintAccessorDecorator.h"
 #include "DeviceModule.h"
 #include "FeedingFanOut.h"
+#include "PeriodicTimerAccessor.h"
 #include "ScalarAccessor.h"
+#include "SpscAccessor.h"
 #include "TestableModeAccessorDecorator.h"
 #include "ThreadedFanOut.h"
 #include "TriggerFanOut.h"
@@ -30,6 +37,7 @@
 #include "Visitor.h"
 #include "XMLGeneratorVisitor.h"
 #include "ExceptionHandlingDecorator.h"
+#include "FusedDeviceAccessorDecorator.h"
 
 using namespace ChimeraTK;
 
@@ -67,6 +75,9 @@ void Application::initialise() {
     throw ChimeraTK::logic_error("Application::initialise() was already called before.");
   }
 
+  auto start = std::chrono::steady_clock::now();
+  startupPhaseStart = start;
+
   // call the user-defined defineConnections() function which describes the structure of the application
   defineConnections();
   for(auto& module : getSubmoduleListRecursive()) {
@@ -77,17 +88,41 @@ void Application::initialise() {
   for(auto& devModule : deviceModuleMap) {
     devModule.second->defineConnections();
   }
+  recordStartupPhase("initialise/defineConnections");
 
   // find and handle constant nodes
   findConstantNodes();
+  recordStartupPhase("initialise/findConstantNodes");
 
   // connect any unconnected accessors with constant values
   processUnconnectedNodes();
+  recordStartupPhase("initialise/processUnconnectedNodes");
 
   // realise the connections between variable accessors as described in the
   // initialise() function
   makeConnections();
 
+  startupProfile.record("initialise/total", std::chrono::steady_clock::now() - start);
+
+  if(startupProfilePublished) {
+    if(!_processVariableManager) {
+      throw ChimeraTK::logic_error("Application::publishStartupProfile() requires a process variable manager.");
+    }
+    // declare the phases measured later, so all process variables exist before the control system adapter starts
+    for(auto phase : {"run/prepare", "run/startThreads", "run/total"}) {
+      startupProfile.declare(phase);
+    }
+    for(auto& deviceModule : deviceModuleMap) {
+      startupProfile.declare(deviceModule.second->getStartupPhaseName("open"));
+      startupProfile.declare(deviceModule.second->getStartupPhaseName("initialisationHandlers"));
+    }
+    for(auto& module : getSubmoduleListRecursive()) {
+      if(module->getModuleType() != ModuleType::ApplicationModule) continue;
+      startupProfile.declare("modules" + module->getQualifiedName());
+    }
+    startupProfile.publish(_processVariableManager, "/Application/startupProfile");
+  }
+
   // set flag to prevent further calls to this function and to prevent definition of additional connections.
   initialiseCalled = true;
 }
@@ -226,6 +261,8 @@ void Application::run() {
     throw ChimeraTK::logic_error("Application::run() has already been called before.");
   }
   runCalled = true;
+  runStartTime = std::chrono::steady_clock::now();
+  startupPhaseStart = runStartTime;
 
   // set all initial version numbers in the modules to the same value
   for(auto& module : getSubmoduleListRecursive()) {
@@ -240,14 +277,27 @@ void Application::run() {
   for(auto& deviceModule : deviceModuleMap) {
     deviceModule.second->prepare();
   }
+  recordStartupPhase("run/prepare");
 
   // Switch life-cycle state to run
   lifeCycleState = LifeCycleState::run;
 
+  // the accessor structure is final now: cache the flat accessor lists used by readAll(), writeAll() etc.
+  for(auto& module : getSubmoduleListRecursive()) {
+    if(module->getModuleType() != ModuleType::ApplicationModule &&
+        module->getModuleType() != ModuleType::VariableGroup) {
+      continue;
+    }
+    module->cacheAccessorLists();
+  }
+
   // start the necessary threads for the FanOuts etc.
   for(auto& internalModule : internalModuleList) {
     internalModule->activate();
   }
+  if(fanOutDispatcherEnabled && !testableMode) {
+    fanOutDispatcher.start(fanOutDispatcherThreads, "FOX");
+  }
 
   for(auto& deviceModule : deviceModuleMap) {
     deviceModule.second->run();
@@ -258,6 +308,12 @@ void Application::run() {
     module->run();
   }
 
+  // start the worker pool for the PooledApplicationModules which have registered in their run() function
+  if(moduleExecutorEnabled && !testableMode) {
+    moduleExecutor.start(moduleExecutorThreads, "AMX");
+  }
+  recordStartupPhase("run/startThreads");
+
   // When in testable mode, wait for all modules to report that they have reched the testable mode.
   // We have to start all module threads first because some modules might only send the initial
   // values in their main loop, and following modules need them to enter testable mode.
@@ -283,6 +339,8 @@ void Application::run() {
     }
   }
 
+  startupProfile.record("run/total", std::chrono::steady_clock::now() - runStartTime);
+
   // Launch circular dependency detector thread
   circularDependencyDetector.startDetectBlockedModules();
 }
@@ -302,11 +360,13 @@ void Application::shutdown() {
   // deactivate the FanOuts first, since they have running threads inside
   // accessing the modules etc. (note: the modules are members of the
   // Application implementation and thus get destroyed after this destructor)
+  fanOutDispatcher.stop();
   for(auto& internalModule : internalModuleList) {
     internalModule->deactivate();
   }
 
   // next deactivate the modules, as they have running threads inside as well
+  moduleExecutor.stop();
   for(auto& module : getSubmoduleListRecursive()) {
     module->terminate();
   }
@@ -436,7 +496,7 @@ VariableNetwork& Application::connect(VariableNetworkNode a, VariableNetworkNode
 
 template<typename UserType>
 boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>> Application::createDeviceVariable(
-    VariableNetworkNode const& node) {
+    VariableNetworkNode const& node, VariableNetworkNode const& appNode) {
   auto deviceAlias = node.getDeviceAlias();
   auto registerName = node.getRegisterName();
   auto direction = node.getDirection();
@@ -469,6 +529,10 @@ boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>> Application::createDe
       accessor = boost::make_shared<TestableModeAccessorDecorator<UserType>>(accessor, true, false, varId, varId);
     }
   }
+  else if(appNode.getType() == NodeType::Application) {
+    // directly connected to an application accessor: propagate the meta data in the same decorator
+    return boost::make_shared<FusedDeviceAccessorDecorator<UserType>>(accessor, node, appNode.getOwningModule());
+  }
 
   return boost::make_shared<ExceptionHandlingDecorator<UserType>>(accessor, node);
 }
@@ -509,7 +573,8 @@ boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>> Application::createPr
 
   // create the ProcessArray for the proper UserType
   auto pvar = _processVariableManager->createProcessArray<UserType>(dir, node.getPublicName(),
-      node.getNumberOfElements(), node.getOwner().getUnit(), node.getOwner().getDescription(), {}, 3, flags);
+      node.getNumberOfElements(), node.getOwner().getUnit(), node.getOwner().getDescription(), {},
+      node.getOwner().getQueueLength(), flags);
   assert(pvar->getName() != "");
 
   // create variable ID
@@ -572,19 +637,38 @@ std::pair<boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>>,
     if(node.getMode() == UpdateMode::push) flags = {AccessMode::wait_for_new_data};
   }
 
+  size_t queueLength = node.getOwner().getQueueLength();
+
+  // The conflating transport is requested by the consuming node. It is not used in testable mode, since the
+  // TestableModeAccessorDecorator expects one read for each write.
+  const auto& consumingNode = consumer.getType() != NodeType::invalid ? consumer : node;
+  bool conflating = consumingNode.isConflating() && flags.has(AccessMode::wait_for_new_data) &&
+      !node.getDirection().withReturn && !testableMode;
+
+  // Direct push-type connections between two ApplicationModules use the lean SpscAccessor. The testable mode keeps
+  // the ProcessArray, which is what the TestableModeAccessorDecorator is tested against.
+  bool spsc = !conflating && node.getType() == NodeType::Application && consumer.getType() == NodeType::Application &&
+      flags.has(AccessMode::wait_for_new_data) && !node.getDirection().withReturn && !testableMode;
+
   // create the ProcessArray for the proper UserType
   std::pair<boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>>,
       boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>>>
       pvarPair;
   if(consumer.getType() != NodeType::invalid)
     assert(node.getDirection().withReturn == consumer.getDirection().withReturn);
-  if(!node.getDirection().withReturn) {
-    pvarPair =
-        createSynchronizedProcessArray<UserType>(nElements, name, node.getUnit(), node.getDescription(), {}, 3, flags);
+  if(conflating) {
+    pvarPair = createConflatingVariable<UserType>(nElements, name, node.getUnit(), node.getDescription());
+  }
+  else if(spsc) {
+    pvarPair = createSpscVariable<UserType>(nElements, name, node.getUnit(), node.getDescription(), queueLength);
+  }
+  else if(!node.getDirection().withReturn) {
+    pvarPair = createSynchronizedProcessArray<UserType>(
+        nElements, name, node.getUnit(), node.getDescription(), {}, queueLength, flags);
   }
   else {
     pvarPair = createBidirectionalSynchronizedProcessArray<UserType>(
-        nElements, name, node.getUnit(), node.getDescription(), {}, 3, flags);
+        nElements, name, node.getUnit(), node.getDescription(), {}, queueLength, flags);
   }
   assert(pvarPair.first->getName() != "");
   assert(pvarPair.second->getName() != "");
@@ -646,24 +730,37 @@ void Application::makeConnections() {
   // finalise connections: decide still-undecided details, in particular for
   // control-system and device varibales, which get created "on the fly".
   finaliseNetworks();
+  recordStartupPhase("initialise/finaliseNetworks");
 
   // apply optimisations
   // note: checks may not be run before since sometimes networks may only be
   // valid after optimisations
   optimiseConnections();
+  recordStartupPhase("initialise/optimiseConnections");
 
   // run checks
   checkConnections();
+  recordStartupPhase("initialise/checkConnections");
 
   // make the connections for all networks
   for(auto& network : networkList) {
     makeConnectionsForNetwork(network);
   }
+  recordStartupPhase("initialise/makeConnectionsForNetwork");
 
   // check for circular dependencies
   for(auto& network : networkList) {
     markCircularConsumers(network);
   }
+  recordStartupPhase("initialise/markCircularConsumers");
+}
+
+/*********************************************************************************************************************/
+
+void Application::recordStartupPhase(const std::string& phase) {
+  auto now = std::chrono::steady_clock::now();
+  startupProfile.record(phase, now - startupPhaseStart);
+  startupPhaseStart = now;
 }
 
 /*********************************************************************************************************************/
@@ -762,70 +859,72 @@ void Application::finaliseNetworks() {
 /*********************************************************************************************************************/
 
 void Application::optimiseConnections() {
-  // list of iterators of networks to be removed from the networkList after the
-  // merge operation
-  std::list<VariableNetwork*> deleteNetworks;
-
-  // search for networks with the same feeder
-  for(auto it1 = networkList.begin(); it1 != networkList.end(); ++it1) {
-    for(auto it2 = it1; it2 != networkList.end(); ++it2) {
-      if(it1 == it2) continue;
-
-      auto feeder1 = it1->getFeedingNode();
-      auto feeder2 = it2->getFeedingNode();
-
-      // this optimisation is only necessary for device-type nodes, since
-      // application and control-system nodes will automatically create merged
-      // networks when having the same feeder
-      /// @todo check if this assumtion is true! control-system nodes can be
-      /// created with different types, too!
-      if(feeder1.getType() != NodeType::Device || feeder2.getType() != NodeType::Device) continue;
-
-      // check if referrring to same register
-      if(feeder1.getDeviceAlias() != feeder2.getDeviceAlias()) continue;
-      if(feeder1.getRegisterName() != feeder2.getRegisterName()) continue;
-
-      // check if directions are the same
-      if(feeder1.getDirection() != feeder2.getDirection()) continue;
-
-      // check if value types and number of elements are compatible
-      if(feeder1.getValueType() != feeder2.getValueType()) continue;
-      if(feeder1.getNumberOfElements() != feeder2.getNumberOfElements()) continue;
-
-      // check if transfer mode is the same
-      if(feeder1.getMode() != feeder2.getMode()) continue;
-
-      // check if triggers are compatible, if present
-      if(feeder1.hasExternalTrigger() != feeder2.hasExternalTrigger()) continue;
-      if(feeder1.hasExternalTrigger()) {
-        if(feeder1.getExternalTrigger() != feeder2.getExternalTrigger()) continue;
-      }
+  // Check if two device feeders refer to the same register in a compatible way, so their networks can be merged. This
+  // optimisation is only necessary for device-type nodes, since application and control-system nodes will
+  // automatically create merged networks when having the same feeder
+  /// @todo check if this assumtion is true! control-system nodes can be
+  /// created with different types, too!
+  auto canMerge = [](const VariableNetworkNode& feeder1, const VariableNetworkNode& feeder2) {
+    // check if directions are the same
+    if(feeder1.getDirection() != feeder2.getDirection()) return false;
+
+    // check if value types and number of elements are compatible
+    if(feeder1.getValueType() != feeder2.getValueType()) return false;
+    if(feeder1.getNumberOfElements() != feeder2.getNumberOfElements()) return false;
+
+    // check if transfer mode is the same
+    if(feeder1.getMode() != feeder2.getMode()) return false;
+
+    // check if triggers are compatible, if present
+    if(feeder1.hasExternalTrigger() != feeder2.hasExternalTrigger()) return false;
+    if(feeder1.hasExternalTrigger()) {
+      if(feeder1.getExternalTrigger() != feeder2.getExternalTrigger()) return false;
+      if(feeder1.getTriggerPrescaler() != feeder2.getTriggerPrescaler()) return false;
+    }
+    return true;
+  };
 
-      // everything should be compatible at this point: merge the networks. We
-      // will merge the network of the outer loop into the network of the inner
-      // loop, since the network of the outer loop will not be found a second
-      // time in the inner loop.
-      for(auto consumer : it1->getConsumingNodes()) {
-        consumer.clearOwner();
-        it2->addNode(consumer);
-      }
+  // Networks with device feeders, indexed by device alias and register name. Only networks referring to the same
+  // register need to be compared, which keeps the merging near-linear in the number of networks.
+  std::unordered_map<std::pair<std::string, std::string>, std::vector<VariableNetwork*>,
+      boost::hash<std::pair<std::string, std::string>>>
+      index;
+
+  // networks to be removed from the networkList after the merge operation
+  std::unordered_set<const VariableNetwork*> deleteNetworks;
+
+  // Each network is merged into the last compatible network in the networkList, so the networks are visited in
+  // reverse order. The consumers of the merged network are appended to the consumers of the remaining network.
+  for(auto it = networkList.rbegin(); it != networkList.rend(); ++it) {
+    auto feeder = it->getFeedingNode();
+    if(feeder.getType() != NodeType::Device) continue;
+
+    auto& candidates = index[{feeder.getDeviceAlias(), feeder.getRegisterName()}];
+    auto target = std::find_if(candidates.begin(), candidates.end(),
+        [&](VariableNetwork* candidate) { return canMerge(feeder, candidate->getFeedingNode()); });
+    if(target == candidates.end()) {
+      candidates.push_back(&(*it));
+      continue;
+    }
 
-      // if trigger present, remove corresponding trigger receiver node from the
-      // trigger network
-      if(feeder1.hasExternalTrigger()) {
-        feeder1.getExternalTrigger().getOwner().removeNodeToTrigger(it1->getFeedingNode());
-      }
+    // everything should be compatible at this point: merge the networks
+    for(auto consumer : it->getConsumingNodes()) {
+      consumer.clearOwner();
+      (*target)->addNode(consumer);
+    }
 
-      // schedule the outer loop network for deletion and stop processing it
-      deleteNetworks.push_back(&(*it1));
-      break;
+    // if trigger present, remove corresponding trigger receiver node from the
+    // trigger network
+    if(feeder.hasExternalTrigger()) {
+      feeder.getExternalTrigger().getOwner().removeNodeToTrigger(feeder);
     }
+
+    // schedule the network for deletion
+    deleteNetworks.insert(&(*it));
   }
 
   // remove networks from the network list
-  for(auto net : deleteNetworks) {
-    networkList.remove(*net);
-  }
+  networkList.remove_if([&](const VariableNetwork& network) { return deleteNetworks.count(&network) > 0; });
 }
 
 /*********************************************************************************************************************/
@@ -920,9 +1019,34 @@ void Application::typedMakeConnection(VariableNetwork& network) {
     bool useExternalTrigger = network.getTriggerType() == VariableNetwork::TriggerType::external;
     bool useFeederTrigger = network.getTriggerType() == VariableNetwork::TriggerType::feeder;
     bool constantFeeder = feeder.getType() == NodeType::Constant;
+    bool timerFeeder = feeder.getType() == NodeType::Timer;
+
+    // special case: a timer is read directly by the TriggerFanOuts of the triggered networks
+    if(timerFeeder) {
+      if(enableDebugMakeConnections) {
+        std::cout << "  Using timer feeder '" << feeder.getName() << "'..." << std::endl;
+      }
 
+      // Create one timer implementation per device, like for other trigger feeders (see setConsumerImplementations()).
+      // All implementations share the epoch, so they tick in phase.
+      auto epoch = boost::chrono::steady_clock::now();
+      auto period = boost::chrono::nanoseconds(feeder.getTimerPeriod().count());
+      std::map<std::string, boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>>> timerImpls;
+      for(auto& consumer : consumers) {
+        if(consumer.getType() != NodeType::TriggerReceiver) {
+          throw ChimeraTK::logic_error("Timers can only be used as triggers!");
+        }
+        std::string deviceAlias = consumer.getNodeToTrigger().getOwner().getFeedingNode().getDeviceAlias();
+        auto& timerImpl = timerImpls[deviceAlias];
+        if(!timerImpl) {
+          timerImpl = boost::make_shared<PeriodicTimerAccessor<UserType>>(feeder.getName(), period, epoch);
+        }
+        consumer.getNodeToTrigger().getOwner().setExternalTriggerImpl(timerImpl);
+      }
+      connectionMade = true;
+    }
     // 1st case: the feeder requires a fixed implementation
-    if(feeder.hasImplementation() && !constantFeeder) {
+    else if(feeder.hasImplementation() && !constantFeeder) {
       if(enableDebugMakeConnections) {
         std::cout << "  Creating fixed implementation for feeder '" << feeder.getName() << "'..." << std::endl;
       }
@@ -930,7 +1054,9 @@ void Application::typedMakeConnection(VariableNetwork& network) {
       // Create feeding implementation.
       boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>> feedingImpl;
       if(feeder.getType() == NodeType::Device) {
-        feedingImpl = createDeviceVariable<UserType>(feeder);
+        // pass the consumer if it will directly use the implementation (see below)
+        auto directConsumer = nNodes == 2 && !useExternalTrigger ? consumers.front() : VariableNetworkNode();
+        feedingImpl = createDeviceVariable<UserType>(feeder, directConsumer);
       }
       else if(feeder.getType() == NodeType::ControlSystem) {
         feedingImpl = createProcessVariable<UserType>(feeder);
@@ -1012,7 +1138,10 @@ void Application::typedMakeConnection(VariableNetwork& network) {
             triggerMap[triggerImplId] = triggerFanOut;
             internalModuleList.push_back(triggerFanOut);
           }
-          fanOut = triggerFanOut->addNetwork(feedingImpl, consumerImplementationPairs);
+          // setConsumerImplementations() creates the trigger impls per device, so each TriggerFanOut reads from a
+          // single device only
+          assert(&triggerFanOut->getDeviceModule() == deviceModuleMap[feeder.getDeviceAlias()]);
+          fanOut = triggerFanOut->addNetwork(feedingImpl, consumerImplementationPairs, feeder.getTriggerPrescaler());
           network.setFanOut(fanOut);
         }
         else if(useFeederTrigger) {
@@ -1084,7 +1213,7 @@ void Application::typedMakeConnection(VariableNetwork& network) {
           feeder.setAppAccessorImplementation<UserType>(impl);
         }
         else if(consumer.getType() == NodeType::Device) {
-          auto impl = createDeviceVariable<UserType>(consumer);
+          auto impl = createDeviceVariable<UserType>(consumer, feeder);
           feeder.setAppAccessorImplementation<UserType>(impl);
         }
         else if(consumer.getType() == NodeType::TriggerReceiver) {
@@ -115,6 +115,9 @@ namespace ChimeraTK {
       }
     }
 
+    auto& app = Application::getInstance();
+    app.startupProfile.record("modules" + getQualifiedName(), std::chrono::steady_clock::now() - app.runStartTime);
+
     // We are holding the testable mode lock, so we are sure the mechanism will work now.
     testableModeReached = true;
 
@@ -6,6 +6,12 @@
  */
 
 #include <ChimeraTK/DeviceBackend.h>
+#include <ChimeraTK/TransferGroup.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <set>
 
 #include "Application.h"
 #include "DeviceModule.h"
@@ -250,7 +256,7 @@ namespace ChimeraTK {
         if(owner->isTestableModeEnabled()) ++owner->testableMode_counter;
       } // else do nothing. There are plenty of errors reported already: The queue is full.
       // set the error flag and notify the other threads
-      deviceHasError = true;
+      setDeviceHasError(true);
       exceptionVersionNumber = {}; // generate a new exception version number
       errorLock.unlock();
     }
@@ -279,11 +285,34 @@ namespace ChimeraTK {
     // flag whether the devices was opened+initialised for the first time
     bool firstSuccess = true;
 
+    // Delay before the next attempt to open/recover the device. Each attempt increases the delay for the next one.
+    const auto& policy = hasReconnectPolicy ? reconnectPolicy : owner->getDefaultReconnectPolicy();
+    std::chrono::duration<double, std::milli> delay = policy.initialDelay;
+    std::mt19937 randomGenerator{std::random_device{}()};
+    std::uniform_real_distribution<double> jitter(-policy.jitter, policy.jitter);
+    bool firstAttempt = true;
+    auto waitBeforeAttempt = [&] {
+      if(delay.count() > 0) {
+        boost::this_thread::sleep_for(boost::chrono::duration<double, boost::milli>(
+            delay.count() * (1. + (policy.jitter > 0. ? jitter(randomGenerator) : 0.))));
+      }
+      if(firstAttempt) {
+        // the first retry is always made after the retryDelay, independent of the initialDelay
+        delay = policy.retryDelay;
+        firstAttempt = false;
+      }
+      else {
+        delay = std::min<std::chrono::duration<double, std::milli>>(delay * policy.backoffFactor, policy.maxDelay);
+      }
+    };
+
+    auto openStart = std::chrono::steady_clock::now();
+
     while(true) {
       // [Spec: 2.3.1] (Re)-open the device.
       do {
         owner->testableModeUnlock("Wait before open/recover device");
-        usleep(500000);
+        waitBeforeAttempt();
         boost::this_thread::interruption_point();
         owner->testableModeLock("Attempt open/recover device");
         try {
@@ -301,6 +330,9 @@ namespace ChimeraTK {
           continue; // should not be necessary because isFunctional() should return false. But no harm in leaving it in.
         }
       } while(!device.isFunctional());
+      if(firstSuccess) {
+        owner->startupProfile.record(getStartupPhaseName("open"), std::chrono::steady_clock::now() - openStart);
+      }
 
       boost::unique_lock<boost::shared_mutex> errorLock(errorMutex);
 
@@ -329,9 +361,14 @@ namespace ChimeraTK {
 
       // [Spec: 2.3.2] Run initialisation handlers
       try {
+        auto initialisationStart = std::chrono::steady_clock::now();
         for(auto& initHandler : initialisationHandlers) {
           initHandler(this);
         }
+        if(firstSuccess) {
+          owner->startupProfile.record(
+              getStartupPhaseName("initialisationHandlers"), std::chrono::steady_clock::now() - initialisationStart);
+        }
       }
       catch(ChimeraTK::runtime_error& e) {
         assert(deviceError.status != StatusOutput::Status::OK); // any error must already be reported...
@@ -349,17 +386,9 @@ namespace ChimeraTK {
       // Write all recovery accessors
       // We are now entering the critical recovery section. It is protected by the recovery mutex until the deviceHasError flag has been cleared.
       boost::unique_lock<boost::shared_mutex> recoveryLock(recoveryMutex);
+      auto recoveryStart = std::chrono::steady_clock::now();
       try {
-        // sort recovery helpers according to write order
-        recoveryHelpers.sort([](boost::shared_ptr<RecoveryHelper>& a, boost::shared_ptr<RecoveryHelper>& b) {
-          return a->writeOrder < b->writeOrder;
-        });
-        for(auto& recoveryHelper : recoveryHelpers) {
-          if(recoveryHelper->versionNumber != VersionNumber{nullptr}) {
-            recoveryHelper->accessor->write(recoveryHelper->versionNumber);
-            recoveryHelper->wasWritten = true;
-          }
-        }
+        writeRecoveryValues();
       }
       catch(ChimeraTK::runtime_error& e) {
         // update error message, since it might have been changed...
@@ -373,10 +402,16 @@ namespace ChimeraTK {
         continue;
       }
 
+      recoveryDuration =
+          std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - recoveryStart).count();
+
       errorLock.lock();
-      deviceHasError = false;
+      setDeviceHasError(false);
       errorLock.unlock();
 
+      // start again with the shortest delay when the next recovery is needed
+      delay = policy.retryDelay;
+
       recoveryLock.unlock();
 
       // send the trigger that the device is available again
@@ -391,6 +426,7 @@ namespace ChimeraTK {
       deviceError.message = "";
       deviceError.setCurrentVersionNumber({});
       deviceError.writeAll();
+      recoveryDuration.write();
       deviceBecameFunctional.write();
 
       if(!firstSuccess) {
@@ -437,21 +473,88 @@ namespace ChimeraTK {
       deviceError.setCurrentVersionNumber({});
       deviceError.writeAll();
 
-      // We must not hold the lock while waiting for the synchronousTransferCounter to go back to 0. Only release it
+      // We must not hold the lock while waiting for the synchronous transfers to finish. Only release it
       // after deviceError has been written, so the CircularDependencyDetector can read the error message from its
       // thread for printing.
       errorLock.unlock();
 
       // [ExceptionHandling Spec: C.3.3.15] Wait for all synchronous transfers to finish before starting recovery.
-      while(synchronousTransferCounter > 0) {
-        usleep(1000);
-      }
+      waitForSynchronousTransfers();
 
     } // while(true)
   }
 
   /*********************************************************************************************************************/
 
+  void DeviceModule::waitForSynchronousTransfers() {
+    std::unique_lock<std::mutex> lock(synchronousTransfersMutex);
+    synchronousTransfersFinished.wait(lock, [&] { return !hasSynchronousTransfers(); });
+  }
+
+  /*********************************************************************************************************************/
+
+  void DeviceModule::notifySynchronousTransfersFinished() {
+    // The lock makes sure the waiting thread either sees the decremented counter when checking the predicate, or is
+    // already waiting when the notification is sent.
+    { std::lock_guard<std::mutex> lock(synchronousTransfersMutex); }
+    synchronousTransfersFinished.notify_one();
+  }
+
+  /*********************************************************************************************************************/
+
+  void DeviceModule::writeRecoveryValues() {
+    // Bring the recovery helpers into ascending write order. Only helpers written since the last recovery can have
+    // changed their position, and their write orders are all larger than the previous ones. Hence it is sufficient
+    // to move them to the end and sort only those.
+    auto firstWritten = std::stable_partition(recoveryHelpers.begin(), recoveryHelpers.end(),
+        [&](const boost::shared_ptr<RecoveryHelper>& h) { return h->writeOrder <= recoveryHelpersSortedUpTo; });
+    std::sort(firstWritten, recoveryHelpers.end(),
+        [](const boost::shared_ptr<RecoveryHelper>& a, const boost::shared_ptr<RecoveryHelper>& b) {
+          return a->writeOrder < b->writeOrder;
+        });
+    if(!recoveryHelpers.empty()) {
+      recoveryHelpersSortedUpTo = std::max(recoveryHelpersSortedUpTo, recoveryHelpers.back()->writeOrder);
+    }
+
+    // If the order does not matter, write everything through one TransferGroup so the backend can merge transfers.
+    // All accessors in the group are written, so it can only be used once all of them are valid.
+    if(!orderedRecovery && !recoveryGroup && !recoveryGroupImpossible && !recoveryHelpers.empty() &&
+        recoveryHelpers.front()->versionNumber != VersionNumber{nullptr}) {
+      std::set<std::string> registers;
+      for(auto& recoveryHelper : recoveryHelpers) {
+        if(!registers.insert(recoveryHelper->accessor->getName()).second) {
+          recoveryGroupImpossible = true;
+          break;
+        }
+      }
+      if(!recoveryGroupImpossible) {
+        recoveryGroup = boost::make_shared<TransferGroup>();
+        for(auto& recoveryHelper : recoveryHelpers) recoveryGroup->addAccessor(recoveryHelper->accessor);
+      }
+    }
+
+    if(recoveryGroup) {
+      VersionNumber version{nullptr};
+      for(auto& recoveryHelper : recoveryHelpers) {
+        if(recoveryHelper->materialise) recoveryHelper->materialise();
+        version = std::max(version, recoveryHelper->versionNumber);
+      }
+      recoveryGroup->write(version);
+      for(auto& recoveryHelper : recoveryHelpers) recoveryHelper->wasWritten = true;
+      return;
+    }
+
+    for(auto& recoveryHelper : recoveryHelpers) {
+      if(recoveryHelper->versionNumber != VersionNumber{nullptr}) {
+        if(recoveryHelper->materialise) recoveryHelper->materialise();
+        recoveryHelper->accessor->write(recoveryHelper->versionNumber);
+        recoveryHelper->wasWritten = true;
+      }
+    }
+  }
+
+  /*********************************************************************************************************************/
+
   void DeviceModule::prepare() {
     if(!deviceIsInitialized) {
       device = Device(deviceAliasOrURI);
@@ -512,6 +615,16 @@ namespace ChimeraTK {
     ControlSystemModule cs;
     deviceError.connectTo(cs["Devices"][deviceAliasOrURI_withoutSlashes]);
     deviceBecameFunctional >> cs["Devices"][deviceAliasOrURI_withoutSlashes]("deviceBecameFunctional");
+    recoveryDuration >> cs["Devices"][deviceAliasOrURI_withoutSlashes]("recoveryDuration");
+  }
+
+  /*********************************************************************************************************************/
+
+  std::string DeviceModule::getStartupPhaseName(const std::string& step) const {
+    // replace all slashes in the deviceAliasOrURI, like in defineConnections()
+    std::string deviceAliasOrURI_withoutSlashes = deviceAliasOrURI;
+    std::replace(deviceAliasOrURI_withoutSlashes.begin(), deviceAliasOrURI_withoutSlashes.end(), '/', '_');
+    return "devices/" + deviceAliasOrURI_withoutSlashes + "/" + step;
   }
 
   /*********************************************************************************************************************/
@@ -522,6 +635,14 @@ namespace ChimeraTK {
 
   /*********************************************************************************************************************/
 
+  void DeviceModule::setReconnectPolicy(const ReconnectPolicy& policy) {
+    policy.check("DeviceModule::setReconnectPolicy() for device " + deviceAliasOrURI);
+    reconnectPolicy = policy;
+    hasReconnectPolicy = true;
+  }
+
+  /*********************************************************************************************************************/
+
   void DeviceModule::addRecoveryAccessor(boost::shared_ptr<RecoveryHelper> recoveryAccessor) {
     recoveryHelpers.push_back(recoveryAccessor);
   }
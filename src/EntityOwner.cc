@@ -8,7 +8,6 @@
 #include <cassert>
 #include <fstream>
 #include <iostream>
-#include <regex>
 
 #include "EntityOwner.h"
 #include "Module.h"
@@ -101,10 +100,13 @@ namespace ChimeraTK {
 
   /*********************************************************************************************************************/
 
-  VirtualModule EntityOwner::findTag(const std::string& tag) const {
+  VirtualModule EntityOwner::findTag(const std::string& tagExpression) const {
     // create new module to return
     VirtualModule module{_name, _description, getModuleType()};
 
+    // resolve the tag expression once for the entire tree
+    auto tag = TagIndex::match(tagExpression);
+
     // add everything matching the tag to the virtual module and return it
     if(this == &Application::getInstance()) {
       // if this module is the top-level application, we need special treatment for HierarchyModifier::moveToRoot
@@ -124,10 +126,13 @@ namespace ChimeraTK {
 
   /*********************************************************************************************************************/
 
-  VirtualModule EntityOwner::excludeTag(const std::string& tag) const {
+  VirtualModule EntityOwner::excludeTag(const std::string& tagExpression) const {
     // create new module to return
     VirtualModule module{_name, _description, getModuleType()};
 
+    // resolve the tag expression once for the entire tree
+    auto tag = TagIndex::match(tagExpression);
+
     // add everything matching the tag to the virtual module and return it
     if(this == &Application::getInstance()) {
       // if this module is the top-level application, we need special treatment for HierarchyModifier::moveToRoot
@@ -148,7 +153,7 @@ namespace ChimeraTK {
   /*********************************************************************************************************************/
 
   // The function adds virtual versions of the EntityOwner itself anf all its children to a virtual module (parent).
-  void EntityOwner::findTagAndAppendToModule(VirtualModule& virtualParent, const std::string& tag,
+  void EntityOwner::findTagAndAppendToModule(VirtualModule& virtualParent, const TagIndex::Match& tag,
       bool eliminateAllHierarchies, bool eliminateFirstHierarchy, bool negate, VirtualModule& root) const {
     // It might be that it is requested to hide ourselves. In this case we do not add
     // ourselves but directly put the children into the parent (or grand parent, depending on the hierarchy modifier).
@@ -199,17 +204,8 @@ namespace ChimeraTK {
     assert(moduleToAddTo != nullptr);
 
     // add nodes to the module if matching the tag
-    std::regex expr(tag);
     for(auto& node : getAccessorList()) {
-      bool addNode = false;
-      for(auto& nodeTag : node.getTags()) {
-        if(std::regex_match(nodeTag, expr)) {
-          addNode = true;
-          break;
-        }
-      }
-      if(node.getTags().size() == 0)
-        if(std::regex_match("", expr)) addNode = true; // check if empty tag matches, if no tag applied to node
+      bool addNode = tag(node.getTagIds());
       if(negate) addNode = !addNode;
       if(addNode) moduleToAddTo->registerAccessor(node);
     }
@@ -33,6 +33,19 @@ namespace ChimeraTK {
           registerName, nElements, 0, {}); // recovery accessors don't have wait_for_new_data
       // version number and write order are still {nullptr} and 0 (i.e. invalid)
       _recoveryHelper = boost::make_shared<RecoveryHelper>(_recoveryAccessor, VersionNumber(nullptr), 0);
+
+      // Buffer retaining the data of destructive writes, see doPreWrite(). It is copied into the recoveryAccessor only
+      // when the DeviceModule actually performs a recovery.
+      _retainedBuffer.resize(buffer_2D.size());
+      for(size_t ch = 0; ch < buffer_2D.size(); ++ch) _retainedBuffer[ch].resize(buffer_2D[ch].size());
+      _recoveryHelper->materialise = [this] {
+        if(!_recoveryDataRetained) return;
+        for(unsigned int ch = 0; ch < _recoveryAccessor->getNumberOfChannels(); ++ch) {
+          _recoveryAccessor->accessChannel(ch) = _retainedBuffer[ch];
+        }
+        _recoveryDataRetained = false;
+      };
+
       _deviceModule->addRecoveryAccessor(_recoveryHelper);
     }
     else if(_direction.dir == VariableDirection::feeding) {
@@ -47,49 +60,74 @@ namespace ChimeraTK {
   void ExceptionHandlingDecorator<UserType>::doPreWrite(TransferType type, VersionNumber versionNumber) {
     /* For writable accessors, copy data to the recoveryAcessor before perfroming the write.
      * Otherwise, the decorated accessor may have swapped the data out of the user buffer already.
-     * This obtains a shared lock from the DeviceModule, hence, the regular writing happeniin here
-     * can be performed in shared mode of the mutex and accessors are not blocking each other.
+     *
+     * Fast path: If the device has no error, the transfer is registered at the DeviceModule without taking any lock.
+     * The DeviceModule will not start a recovery before the transfer has finished, so the recoveryAccessor can be
+     * updated without holding the recovery lock. For destructive writes the data is not copied at all: The target
+     * writes non-destructively and the data is swapped into the _retainedBuffer in doPostWrite(). It is copied into
+     * the recoveryAccessor only if a recovery is needed (see RecoveryHelper::materialise).
+     *
+     * Slow path: If the device has an error, the recoveryAccessor is updated under a shared lock of the recovery mutex.
      * In case of recovery, the DeviceModule thread will take an exclusive lock so that this thread can not
      * modify the recoveryAcessor's user buffer while data is written to the device.
      */
-    {
-      _inhibitWriteTransfer = false;
-      _hasThrownLogicError = false;
-      _dataLostInPreviousWrite = false;
-      auto recoverylock{_deviceModule->getRecoverySharedLock()};
+    _inhibitWriteTransfer = false;
+    _hasThrownLogicError = false;
+    _dataLostInPreviousWrite = false;
 
-      if(_recoveryAccessor != nullptr) {
-        if(!_recoveryHelper->wasWritten && (_recoveryHelper->writeOrder != 0)) {
-          _dataLostInPreviousWrite = true;
-        }
+    if(_recoveryAccessor == nullptr) {
+      _hasThrownLogicError = true;
+      throw ChimeraTK::logic_error(
+          "ChimeraTK::ExceptionhandlingDecorator: Calling write() on a non-writeable accessor is not supported ");
+    }
 
-        // Access to _recoveryAccessor is only possible channel-wise
-        for(unsigned int ch = 0; ch < _recoveryAccessor->getNumberOfChannels(); ++ch) {
-          _recoveryAccessor->accessChannel(ch) = buffer_2D[ch];
-        }
-        _recoveryHelper->versionNumber = versionNumber;
-        _recoveryHelper->writeOrder = _deviceModule->writeOrder();
-        _recoveryHelper->wasWritten = false;
+    _retainInPostWrite = false;
+    if(_deviceModule->beginSynchronousTransfer()) {
+      if(type == TransferType::writeDestructively) {
+        updateRecoveryHelper(versionNumber);
+        _retainInPostWrite = true;
       }
       else {
-        _hasThrownLogicError = true;
-        throw ChimeraTK::logic_error(
-            "ChimeraTK::ExceptionhandlingDecorator: Calling write() on a non-writeable accessor is not supported ");
+        updateRecoveryAccessor(versionNumber);
       }
+    }
+    else {
+      auto recoverylock{_deviceModule->getRecoverySharedLock()};
+      updateRecoveryAccessor(versionNumber);
 
+      // The device might have recovered in the mean time. The flag cannot change while holding the errorMutex.
       boost::shared_lock<boost::shared_mutex> errorLock(_deviceModule->errorMutex);
-      if(_deviceModule->deviceHasError) {
+      if(!_deviceModule->beginSynchronousTransfer()) {
         _inhibitWriteTransfer = true;
         return;
       }
-
-      ++_deviceModule->synchronousTransferCounter; // must be under the lock
-
-    } // lock guard goes out of scope
+    } // lock guards go out of scope
 
     // Now delegate call to the generic decorator, which swaps the buffer, without adding our exception handling with the generic transfer
     // preWrite and postWrite are only delegated if the transfer is allowed.
-    ChimeraTK::NDRegisterAccessorDecorator<UserType>::doPreWrite(type, versionNumber);
+    // If the data is retained, the target must write non-destructively.
+    ChimeraTK::NDRegisterAccessorDecorator<UserType>::doPreWrite(
+        _retainInPostWrite ? TransferType::write : type, versionNumber);
+  }
+
+  template<typename UserType>
+  void ExceptionHandlingDecorator<UserType>::updateRecoveryAccessor(VersionNumber versionNumber) {
+    // Access to _recoveryAccessor is only possible channel-wise
+    for(unsigned int ch = 0; ch < _recoveryAccessor->getNumberOfChannels(); ++ch) {
+      _recoveryAccessor->accessChannel(ch) = buffer_2D[ch];
+    }
+    _recoveryDataRetained = false;
+    updateRecoveryHelper(versionNumber);
+  }
+
+  template<typename UserType>
+  void ExceptionHandlingDecorator<UserType>::updateRecoveryHelper(VersionNumber versionNumber) {
+    if(!_recoveryHelper->wasWritten && (_recoveryHelper->writeOrder != 0)) {
+      _dataLostInPreviousWrite = true;
+    }
+    _recoveryHelper->versionNumber = versionNumber;
+    _recoveryHelper->writeOrder = _deviceModule->writeOrder();
+    _recoveryHelper->wasWritten = false;
   }
 
   template<typename UserType>
@@ -100,15 +138,26 @@ namespace ChimeraTK {
       return;
     }
     if(!_inhibitWriteTransfer) {
-      --_deviceModule->synchronousTransferCounter;
       try {
-        ChimeraTK::NDRegisterAccessorDecorator<UserType>::doPostWrite(type, versionNumber);
-        {
-          auto recoverylock{_deviceModule->getRecoverySharedLock()};
-          // the transfer was successful or doPostRead did not throw and we reach this point,
-          // so we matk these data as written
-          _recoveryHelper->wasWritten = true;
-        } // end scope for recovery lock
+        if(_retainInPostWrite) {
+          // The target still holds the data, since it has written non-destructively. Keep the data in the
+          // _retainedBuffer for a possible recovery, even if the transfer has failed. The user buffer is left with the
+          // previous buffer of the target, which is fine after a destructive write.
+          auto _ = cppext::finally([&] {
+            for(size_t ch = 0; ch < _retainedBuffer.size(); ++ch) {
+              _retainedBuffer[ch].swap(_target->accessChannel(static_cast<unsigned int>(ch)));
+            }
+            _recoveryDataRetained = true;
+          });
+          _target->setActiveException(this->_activeException);
+          _target->postWrite(TransferType::write, versionNumber);
+        }
+        else {
+          ChimeraTK::NDRegisterAccessorDecorator<UserType>::doPostWrite(type, versionNumber);
+        }
+        // The transfer was successful or doPostRead did not throw and we reach this point, so we mark these data as
+        // written. The transfer is still registered, so no recovery can run concurrently.
+        _recoveryHelper->wasWritten = true;
       }
       catch(ChimeraTK::runtime_error& e) {
         // Report exception to the exception backend. This would be done by the TransferElement base class only if we
@@ -117,6 +166,7 @@ namespace ChimeraTK {
         // Report exception to the DeviceModule
         _deviceModule->reportException(std::string(e.what()) + " (seen by '" + _target->getName() + "')");
       }
+      _deviceModule->endSynchronousTransfer();
     }
     assert(_activeException == nullptr);
   }
@@ -127,7 +177,7 @@ namespace ChimeraTK {
     if(!_hasThrownToInhibitTransfer) {
       try {
         if(!TransferElement::_accessModeFlags.has(AccessMode::wait_for_new_data)) { // was as synchronous transfer
-          --_deviceModule->synchronousTransferCounter;
+          _deviceModule->endSynchronousTransfer();
         }
         _target->setActiveException(this->_activeException);
         _target->postRead(type, hasNewData);
@@ -188,14 +238,11 @@ namespace ChimeraTK {
     }
 
     if(!TransferElement::_accessModeFlags.has(AccessMode::wait_for_new_data)) {
-      boost::shared_lock<boost::shared_mutex> errorLock(_deviceModule->errorMutex);
-      if(_deviceModule->deviceHasError) {
+      // lock-free: either the transfer is registered before the error flag is set, or the flag is seen here
+      if(!_deviceModule->beginSynchronousTransfer()) {
         _hasThrownToInhibitTransfer = true;
         throw ChimeraTK::runtime_error("ExceptionHandlingDecorator has thrown to skip read transfer");
       }
-      // must hold the errorMutex while modifying the counter, and it must not be given up
-      // after the decision to do the transfer until here
-      ++_deviceModule->synchronousTransferCounter;
     }
 
     ChimeraTK::NDRegisterAccessorDecorator<UserType>::doPreRead(type);
@@ -203,11 +250,14 @@ namespace ChimeraTK {
 
   template<typename UserType>
   bool ExceptionHandlingDecorator<UserType>::doWriteTransfer(VersionNumber versionNumber) {
-    return genericWriteWrapper([&] { return _target->writeTransferDestructively(versionNumber); });
+    return genericWriteWrapper([&] { return _target->writeTransfer(versionNumber); });
   }
 
   template<typename UserType>
   bool ExceptionHandlingDecorator<UserType>::doWriteTransferDestructively(VersionNumber versionNumber) {
+    if(_retainInPostWrite) {
+      return genericWriteWrapper([&] { return _target->writeTransfer(versionNumber); });
+    }
     return genericWriteWrapper([&] { return _target->writeTransferDestructively(versionNumber); });
   }
 
@@ -0,0 +1,41 @@
+#include "FusedDeviceAccessorDecorator.h"
+
+namespace ChimeraTK {
+
+  template<typename UserType>
+  FusedDeviceAccessorDecorator<UserType>::FusedDeviceAccessorDecorator(
+      boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>> accessor, VariableNetworkNode networkNode,
+      EntityOwner* owner)
+  : ExceptionHandlingDecorator<UserType>(accessor, networkNode), _owner(owner) {}
+
+  /*********************************************************************************************************************/
+
+  template<typename UserType>
+  void FusedDeviceAccessorDecorator<UserType>::doPreWrite(TransferType type, VersionNumber versionNumber) {
+    // The validity written to the target is the propagated one, but the flag set by the application must stay intact.
+    auto applicationValidity = _dataValidity;
+    _dataValidity = propagateWriteMetaData(_owner, applicationValidity);
+    try {
+      ExceptionHandlingDecorator<UserType>::doPreWrite(type, versionNumber);
+    }
+    catch(...) {
+      _dataValidity = applicationValidity;
+      throw;
+    }
+    _dataValidity = applicationValidity;
+  }
+
+  /*********************************************************************************************************************/
+
+  template<typename UserType>
+  void FusedDeviceAccessorDecorator<UserType>::doPostRead(TransferType type, bool hasNewData) {
+    ExceptionHandlingDecorator<UserType>::doPostRead(type, hasNewData);
+    propagateReadMetaData(_owner, type, TransferElement::_accessModeFlags.has(AccessMode::wait_for_new_data),
+        _dataValidity, this->_versionNumber);
+  }
+
+  /*********************************************************************************************************************/
+
+  INSTANTIATE_TEMPLATE_FOR_CHIMERATK_USER_TYPES(FusedDeviceAccessorDecorator);
+
+} /* namespace ChimeraTK */
@@ -62,7 +62,7 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
-  void HierarchyModifyingGroup::findTagAndAppendToModule(VirtualModule& virtualParent, const std::string& tag,
+  void HierarchyModifyingGroup::findTagAndAppendToModule(VirtualModule& virtualParent, const TagIndex::Match& tag,
       bool eliminateAllHierarchies, bool eliminateFirstHierarchy, bool negate, VirtualModule& root) const {
     // the virtual parent to use depends on moveToRoot and will change while walking through the tree
     VirtualModule *currentVirtualParent = &virtualParent;
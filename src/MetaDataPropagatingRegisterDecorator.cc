@@ -6,59 +6,67 @@
 
 namespace ChimeraTK {
 
-  template<typename T>
-  void MetaDataPropagatingRegisterDecorator<T>::doPostRead(TransferType type, bool hasNewData) {
-    NDRegisterAccessorDecorator<T, T>::doPostRead(type, hasNewData);
-
+  void MetaDataPropagationFlagProvider::propagateReadMetaData(
+      EntityOwner* owner, TransferType type, bool isPushType, DataValidity validity, VersionNumber versionNumber) {
     // update the version number
-    if(_target->getAccessModeFlags().has(AccessMode::wait_for_new_data) && type == TransferType::read) {
-      _owner->setCurrentVersionNumber(this->getVersionNumber());
+    if(isPushType && type == TransferType::read) {
+      owner->setCurrentVersionNumber(versionNumber);
     }
 
     // Check if the data validity flag changed. If yes, propagate this information to the owning module and the application
-    if(_dataValidity != lastValidity) {
-      if(_dataValidity == DataValidity::faulty) { // data validity changes to faulty
-        _owner->incrementDataFaultCounter();
+    if(validity != lastValidity) {
+      if(validity == DataValidity::faulty) { // data validity changes to faulty
+        owner->incrementDataFaultCounter();
         // external inpput in a circular dependency network
-        if(_owner->getCircularNetworkHash() && !_isCircularInput) {
-          ++(Application::getInstance().circularNetworkInvalidityCounters[_owner->getCircularNetworkHash()]);
+        if(owner->getCircularNetworkHash() && !_isCircularInput) {
+          ++(Application::getInstance().circularNetworkInvalidityCounters[owner->getCircularNetworkHash()]);
         }
       }
       else { // data validity changed to OK
-        _owner->decrementDataFaultCounter();
+        owner->decrementDataFaultCounter();
         // external inpput in a circular dependency network
-        if(_owner->getCircularNetworkHash() && !_isCircularInput) {
-          --(Application::getInstance().circularNetworkInvalidityCounters[_owner->getCircularNetworkHash()]);
+        if(owner->getCircularNetworkHash() && !_isCircularInput) {
+          --(Application::getInstance().circularNetworkInvalidityCounters[owner->getCircularNetworkHash()]);
         }
       }
-      lastValidity = _dataValidity;
+      lastValidity = validity;
     }
   }
 
-  template<typename T>
-  void MetaDataPropagatingRegisterDecorator<T>::doPreWrite(TransferType type, VersionNumber versionNumber) {
-    // We cannot use NDRegisterAccessorDecorator<T> here because we need a different implementation of setting the target data validity.
-    // So we have a complete implemetation here.
-
-    if(_owner->getCircularNetworkHash() && _dataValidity != lastValidity) {
+  DataValidity MetaDataPropagationFlagProvider::propagateWriteMetaData(EntityOwner* owner, DataValidity validity) {
+    if(owner->getCircularNetworkHash() && validity != lastValidity) {
       // In circular dependency networks an output which actively has DataValidity::faulty set by the user logic is handled
       // as if an external input was invalid -> increase or decrease the network's invalidity counter accordingly
-      if(_dataValidity == DataValidity::faulty) { // data validity changes to faulty
-        ++(Application::getInstance().circularNetworkInvalidityCounters[_owner->getCircularNetworkHash()]);
+      if(validity == DataValidity::faulty) { // data validity changes to faulty
+        ++(Application::getInstance().circularNetworkInvalidityCounters[owner->getCircularNetworkHash()]);
       }
       else {
-        --(Application::getInstance().circularNetworkInvalidityCounters[_owner->getCircularNetworkHash()]);
+        --(Application::getInstance().circularNetworkInvalidityCounters[owner->getCircularNetworkHash()]);
       }
-      lastValidity = _dataValidity;
+      lastValidity = validity;
     }
 
-    // Now propagate the flag and the data to the target and perform the write
-    if(_dataValidity == DataValidity::faulty) { // the application has manualy set the validity to faulty
-      _target->setDataValidity(DataValidity::faulty);
-    }
-    else { // automatic propagation of the owner validity
-      _target->setDataValidity(_owner->getDataValidity());
+    if(validity == DataValidity::faulty) { // the application has manualy set the validity to faulty
+      return DataValidity::faulty;
     }
+    // automatic propagation of the owner validity
+    return owner->getDataValidity();
+  }
+
+  template<typename T>
+  void MetaDataPropagatingRegisterDecorator<T>::doPostRead(TransferType type, bool hasNewData) {
+    NDRegisterAccessorDecorator<T, T>::doPostRead(type, hasNewData);
+    propagateReadMetaData(_owner, type, _target->getAccessModeFlags().has(AccessMode::wait_for_new_data),
+        _dataValidity, this->getVersionNumber());
+  }
+
+  template<typename T>
+  void MetaDataPropagatingRegisterDecorator<T>::doPreWrite(TransferType type, VersionNumber versionNumber) {
+    // We cannot use NDRegisterAccessorDecorator<T> here because we need a different implementation of setting the target data validity.
+    // So we have a complete implemetation here.
+
+    // Now propagate the flag and the data to the target and perform the write
+    _target->setDataValidity(propagateWriteMetaData(_owner, _dataValidity));
 
     for(unsigned int i = 0; i < _target->getNumberOfChannels(); ++i) {
       buffer_2D[i].swap(_target->accessChannel(i));
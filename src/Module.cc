@@ -37,6 +37,8 @@ namespace ChimeraTK {
   Module& Module::operator=(Module&& other) {
     EntityOwner::operator=(std::move(other));
     _owner = other._owner;
+    _accessorLists = {};
+    _accessorListsCached = false;
     if(_owner != nullptr) _owner->registerModule(this, false);
     // note: the other module unregisters itself in its destructor - which will be called next after any move operation
     return *this;
@@ -49,15 +51,52 @@ namespace ChimeraTK {
 
   /*********************************************************************************************************************/
 
+  Module::AccessorLists Module::makeAccessorLists() const {
+    AccessorLists lists;
+    for(auto& accessor : getAccessorListRecursive()) {
+      auto direction = accessor.getDirection();
+      auto* element = &accessor.getAppAccessorNoType();
+      bool feeding = direction.dir == VariableDirection::feeding;
+      if(!feeding || direction.withReturn) {
+        lists.readables.push_back({element, feeding});
+        if(accessor.getMode() == UpdateMode::push) {
+          lists.pushReadables.push_back({element, feeding});
+        }
+        else if(!feeding) {
+          lists.pollInputs.push_back(element);
+        }
+      }
+      if(feeding || direction.withReturn) {
+        lists.writables.push_back({element, !feeding});
+      }
+    }
+    return lists;
+  }
+
+  /*********************************************************************************************************************/
+
+  const Module::AccessorLists& Module::getAccessorLists(AccessorLists& buffer) const {
+    if(_accessorListsCached) return _accessorLists;
+    buffer = makeAccessorLists();
+    return buffer;
+  }
+
+  /*********************************************************************************************************************/
+
+  void Module::cacheAccessorLists() {
+    _accessorLists = makeAccessorLists();
+    _accessorListsCached = true;
+  }
+
+  /*********************************************************************************************************************/
+
   ChimeraTK::ReadAnyGroup Module::readAnyGroup() {
-    auto recursiveAccessorList = getAccessorListRecursive();
+    AccessorLists buffer;
+    auto& lists = getAccessorLists(buffer);
 
-    // put push-type transfer elements into a ReadAnyGroup
+    // put all readable transfer elements into a ReadAnyGroup
     ChimeraTK::ReadAnyGroup group;
-    for(auto& accessor : recursiveAccessorList) {
-      if(accessor.getDirection() == VariableDirection{VariableDirection::feeding, false}) continue;
-      group.add(accessor.getAppAccessorNoType());
-    }
+    for(auto& entry : lists.readables) group.add(*entry.element);
 
     group.finalise();
     return group;
@@ -66,61 +105,38 @@ namespace ChimeraTK {
   /*********************************************************************************************************************/
 
   void Module::readAll(bool includeReturnChannels) {
-    auto recursiveAccessorList = getAccessorListRecursive();
+    AccessorLists buffer;
+    auto& lists = getAccessorLists(buffer);
     // first blockingly read all push-type variables
-    for(auto accessor : recursiveAccessorList) {
-      if(accessor.getMode() != UpdateMode::push) continue;
-      if(includeReturnChannels) {
-        if(accessor.getDirection() == VariableDirection{VariableDirection::feeding, false}) continue;
-      }
-      else {
-        if(accessor.getDirection().dir != VariableDirection::consuming) continue;
-      }
-      accessor.getAppAccessorNoType().read();
+    for(auto& entry : lists.pushReadables) {
+      if(entry.isReturnChannel && !includeReturnChannels) continue;
+      entry.element->read();
     }
     // next non-blockingly read the latest values of all poll-type variables
-    for(auto accessor : recursiveAccessorList) {
-      if(accessor.getMode() == UpdateMode::push) continue;
-      // poll-type accessors cannot have a readback channel
-      if(accessor.getDirection().dir != VariableDirection::consuming) continue;
-      accessor.getAppAccessorNoType().readLatest();
-    }
+    // (poll-type accessors cannot have a readback channel)
+    for(auto* element : lists.pollInputs) element->readLatest();
   }
 
   /*********************************************************************************************************************/
 
   void Module::readAllNonBlocking(bool includeReturnChannels) {
-    auto recursiveAccessorList = getAccessorListRecursive();
-    for(auto accessor : recursiveAccessorList) {
-      if(accessor.getMode() != UpdateMode::push) continue;
-      if(includeReturnChannels) {
-        if(accessor.getDirection() == VariableDirection{VariableDirection::feeding, false}) continue;
-      }
-      else {
-        if(accessor.getDirection().dir != VariableDirection::consuming) continue;
-      }
-      accessor.getAppAccessorNoType().readNonBlocking();
-    }
-    for(auto accessor : recursiveAccessorList) {
-      if(accessor.getMode() == UpdateMode::push) continue;
-      // poll-type accessors cannot have a readback channel
-      if(accessor.getDirection().dir != VariableDirection::consuming) continue;
-      accessor.getAppAccessorNoType().readLatest();
+    AccessorLists buffer;
+    auto& lists = getAccessorLists(buffer);
+    for(auto& entry : lists.pushReadables) {
+      if(entry.isReturnChannel && !includeReturnChannels) continue;
+      entry.element->readNonBlocking();
     }
+    for(auto* element : lists.pollInputs) element->readLatest();
   }
 
   /*********************************************************************************************************************/
 
   void Module::readAllLatest(bool includeReturnChannels) {
-    auto recursiveAccessorList = getAccessorListRecursive();
-    for(auto accessor : recursiveAccessorList) {
-      if(includeReturnChannels) {
-        if(accessor.getDirection() == VariableDirection{VariableDirection::feeding, false}) continue;
-      }
-      else {
-        if(accessor.getDirection().dir != VariableDirection::consuming) continue;
-      }
-      accessor.getAppAccessorNoType().readLatest();
+    AccessorLists buffer;
+    auto& lists = getAccessorLists(buffer);
+    for(auto& entry : lists.readables) {
+      if(entry.isReturnChannel && !includeReturnChannels) continue;
+      entry.element->readLatest();
     }
   }
 
@@ -128,15 +144,11 @@ namespace ChimeraTK {
 
   void Module::writeAll(bool includeReturnChannels) {
     auto versionNumber = getCurrentVersionNumber();
-    auto recursiveAccessorList = getAccessorListRecursive();
-    for(auto accessor : recursiveAccessorList) {
-      if(includeReturnChannels) {
-        if(accessor.getDirection() == VariableDirection{VariableDirection::consuming, false}) continue;
-      }
-      else {
-        if(accessor.getDirection().dir != VariableDirection::feeding) continue;
-      }
-      accessor.getAppAccessorNoType().write(versionNumber);
+    AccessorLists buffer;
+    auto& lists = getAccessorLists(buffer);
+    for(auto& entry : lists.writables) {
+      if(entry.isReturnChannel && !includeReturnChannels) continue;
+      entry.element->write(versionNumber);
     }
   }
 
@@ -144,15 +156,11 @@ namespace ChimeraTK {
 
   void Module::writeAllDestructively(bool includeReturnChannels) {
     auto versionNumber = getCurrentVersionNumber();
-    auto recursiveAccessorList = getAccessorListRecursive();
-    for(auto accessor : recursiveAccessorList) {
-      if(includeReturnChannels) {
-        if(accessor.getDirection() == VariableDirection{VariableDirection::consuming, false}) continue;
-      }
-      else {
-        if(accessor.getDirection().dir != VariableDirection::feeding) continue;
-      }
-      accessor.getAppAccessorNoType().writeDestructively(versionNumber);
+    AccessorLists buffer;
+    auto& lists = getAccessorLists(buffer);
+    for(auto& entry : lists.writables) {
+      if(entry.isReturnChannel && !includeReturnChannels) continue;
+      entry.element->writeDestructively(versionNumber);
     }
   }
 
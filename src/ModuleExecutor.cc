@@ -0,0 +1,222 @@
+#include "ModuleExecutor.h"
+#include "Application.h"
+
+#include <list>
+#include <thread>
+
+namespace ChimeraTK {
+
+  /*********************************************************************************************************************/
+
+  ModuleExecutor::~ModuleExecutor() { stop(); }
+
+  /*********************************************************************************************************************/
+
+  void ModuleExecutor::addClient(ExecutorClient* client) {
+    if(isRunning()) {
+      throw ChimeraTK::logic_error("ModuleExecutor::addClient() called after the executor has been started.");
+    }
+    _clients.push_back(client);
+  }
+
+  /*********************************************************************************************************************/
+
+  void ModuleExecutor::start(size_t nThreads, const std::string& name) {
+    assert(!isRunning());
+    if(_clients.empty()) return;
+    if(nThreads == 0) nThreads = std::max(1U, std::thread::hardware_concurrency());
+    _name = name;
+    {
+      std::lock_guard<std::mutex> lock(_idleMutex);
+      _stop = false;
+    }
+
+    // Collect the queues of all clients. Index 0 is reserved for the wakeup queue.
+    std::list<cppext::future_queue<void>> queueList;
+    queueList.push_back(_wakeupQueue);
+    _queueOwners.push_back(nullptr);
+    for(auto* client : _clients) {
+      for(auto& queue : client->getNotificationQueues()) {
+        queueList.push_back(queue);
+        _queueOwners.push_back(client);
+      }
+    }
+    _notificationQueue = cppext::when_any(queueList.begin(), queueList.end());
+
+    // Each client is processed once initially, e.g. to consume initial values which have arrived already. The counter
+    // must be set before the dispatcher is started, otherwise a notification could schedule the client twice.
+    for(auto* client : _clients) {
+      client->_pendingNotifications = 1;
+    }
+
+    for(size_t i = 0; i < nThreads; ++i) {
+      _workers.emplace_back(std::make_unique<Worker>());
+    }
+    for(size_t i = 0; i < nThreads; ++i) {
+      _workers[i]->thread = boost::thread([this, i] { workerLoop(i); });
+    }
+    _dispatcherThread = boost::thread([this] { dispatcherLoop(); });
+
+    // From now on schedule() posts the clients. A client scheduled before has not been posted, but it will see the
+    // initial processing below.
+    {
+      std::lock_guard<std::mutex> lock(_scheduleMutex);
+      _acceptSchedule = true;
+    }
+    for(auto* client : _clients) {
+      post(client);
+    }
+  }
+
+  /*********************************************************************************************************************/
+
+  void ModuleExecutor::stop() {
+    if(!isRunning()) return;
+
+    // stop the dispatcher and schedule() first, so no new jobs are posted
+    {
+      std::lock_guard<std::mutex> scheduleLock(_scheduleMutex);
+      _acceptSchedule = false;
+      std::lock_guard<std::mutex> lock(_idleMutex);
+      _stop = true;
+    }
+    _wakeupQueue.push();
+    _dispatcherThread.join();
+
+    // Wake up all workers. Workers currently executing a client are interrupted, in case the client blocks e.g. in a
+    // read of a poll-type input.
+    {
+      std::lock_guard<std::mutex> lock(_idleMutex);
+      _idleCondition.notify_all();
+    }
+    for(auto& worker : _workers) {
+      worker->thread.interrupt();
+    }
+    for(auto& worker : _workers) {
+      worker->thread.join();
+    }
+    _workers.clear();
+  }
+
+  /*********************************************************************************************************************/
+
+  void ModuleExecutor::schedule(ExecutorClient* client) {
+    std::lock_guard<std::mutex> lock(_scheduleMutex);
+    if(!_acceptSchedule) return;
+    if(client->_pendingNotifications++ == 0) post(client);
+  }
+
+  /*********************************************************************************************************************/
+
+  void ModuleExecutor::post(ExecutorClient* client) {
+    size_t index;
+    {
+      std::lock_guard<std::mutex> lock(_idleMutex);
+      index = _nextWorker;
+      _nextWorker = (_nextWorker + 1) % _workers.size();
+    }
+    {
+      std::lock_guard<std::mutex> lock(_workers[index]->mutex);
+      _workers[index]->jobs.push_back(client);
+    }
+    {
+      std::lock_guard<std::mutex> lock(_idleMutex);
+      ++_nJobs;
+    }
+    _idleCondition.notify_one();
+  }
+
+  /*********************************************************************************************************************/
+
+  ExecutorClient* ModuleExecutor::takeJob(size_t workerIndex) {
+    // own queue: take the newest job first, as its data is most likely still in the cache
+    {
+      auto& worker = *_workers[workerIndex];
+      std::lock_guard<std::mutex> lock(worker.mutex);
+      if(!worker.jobs.empty()) {
+        auto* client = worker.jobs.back();
+        worker.jobs.pop_back();
+        return client;
+      }
+    }
+    // steal the oldest job from the other workers
+    for(size_t i = 1; i < _workers.size(); ++i) {
+      auto& victim = *_workers[(workerIndex + i) % _workers.size()];
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      if(!victim.jobs.empty()) {
+        auto* client = victim.jobs.front();
+        victim.jobs.pop_front();
+        return client;
+      }
+    }
+    return nullptr;
+  }
+
+  /*********************************************************************************************************************/
+
+  void ModuleExecutor::execute(ExecutorClient* client) {
+    size_t nProcessed = client->_pendingNotifications.load();
+    while(true) {
+      try {
+        client->processUpdates();
+      }
+      catch(boost::thread_interrupted&) {
+        // The client's accessors have been interrupted during shutdown. Leave the pending counter non-zero, so the
+        // client will never be scheduled again.
+        return;
+      }
+      // If no notification has arrived while processing, the counter drops to 0 and the next notification will post
+      // the client again. Otherwise process the new data right away.
+      if(client->_pendingNotifications.fetch_sub(nProcessed) == nProcessed) return;
+      nProcessed = client->_pendingNotifications.load();
+    }
+  }
+
+  /*********************************************************************************************************************/
+
+  void ModuleExecutor::workerLoop(size_t workerIndex) {
+    Application::registerThread(_name + std::to_string(workerIndex));
+    try {
+      while(true) {
+        {
+          std::unique_lock<std::mutex> lock(_idleMutex);
+          _idleCondition.wait(lock, [this] { return _nJobs > 0 || _stop; });
+          if(_stop) return;
+          --_nJobs;
+        }
+        // We have claimed one job, so there is at least one job in one of the queues for us. It might just be taken
+        // by another worker which has claimed a job as well, in which case another job must be present.
+        ExecutorClient* client;
+        while((client = takeJob(workerIndex)) == nullptr) {
+          boost::this_thread::yield();
+        }
+        Profiler::startMeasurement();
+        execute(client);
+        Profiler::stopMeasurement();
+      }
+    }
+    catch(boost::thread_interrupted&) {
+      // interrupted by stop() outside execute()
+    }
+  }
+
+  /*********************************************************************************************************************/
+
+  void ModuleExecutor::dispatcherLoop() {
+    Application::registerThread(_name + "Dispatch");
+    while(true) {
+      size_t index;
+      _notificationQueue.pop_wait(index);
+      if(index == 0) {
+        _wakeupQueue.pop();
+        if(_stop) return;
+        continue;
+      }
+      auto* client = _queueOwners[index];
+      if(client->_pendingNotifications++ == 0) post(client);
+    }
+  }
+
+  /*********************************************************************************************************************/
+
+} // namespace ChimeraTK
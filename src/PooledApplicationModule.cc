@@ -0,0 +1,104 @@
+#include "PooledApplicationModule.h"
+
+namespace ChimeraTK {
+
+  /*********************************************************************************************************************/
+
+  void PooledApplicationModule::run() {
+    auto& app = Application::getInstance();
+    if(!app.isModuleExecutorEnabled() || app.isTestableModeEnabled()) {
+      ApplicationModule::run();
+      return;
+    }
+
+    // Observe the same elements as readAnyGroup() does in mainLoop(). Initial values are expected only on inputs,
+    // not on return channels.
+    for(auto& variable : getAccessorListRecursive()) {
+      if(variable.getDirection() == VariableDirection{VariableDirection::feeding, false}) continue;
+      auto el{variable.getAppAccessorNoType().getHighLevelImplElement()};
+      if(el->getAccessModeFlags().has(AccessMode::wait_for_new_data)) {
+        _pushInputs.push_back({variable, variable.getDirection().dir == VariableDirection::consuming});
+      }
+      else if(variable.getDirection().dir == VariableDirection::consuming) {
+        _pollInputs.push_back(variable);
+      }
+    }
+
+    app.moduleExecutor.addClient(this);
+
+    // The initial values are obtained in a separate thread, since the reads may block until the devices have been
+    // opened. The module is scheduled on the pool when all initial values have been received.
+    assert(!moduleThread.joinable());
+    moduleThread = boost::thread(&PooledApplicationModule::startupWrapper, this);
+  }
+
+  /*********************************************************************************************************************/
+
+  void PooledApplicationModule::startupWrapper() {
+    Application::registerThread("AM_" + getName());
+    auto& app = Application::getInstance();
+
+    // Same order as in ApplicationModule::mainLoopWrapper(): poll-type reads might trigger distribution of values to
+    // push-type variables via a ConsumingFanOut.
+    for(auto& input : _pollInputs) {
+      app.circularDependencyDetector.registerDependencyWait(input);
+      input.getAppAccessorNoType().read();
+      app.circularDependencyDetector.unregisterDependencyWait(input);
+    }
+    for(auto& input : _pushInputs) {
+      if(!input.isInput) continue;
+      app.circularDependencyDetector.registerDependencyWait(input.node);
+      input.node.getAppAccessorNoType().read();
+      app.circularDependencyDetector.unregisterDependencyWait(input.node);
+    }
+
+    app.startupProfile.record("modules" + getQualifiedName(), std::chrono::steady_clock::now() - app.runStartTime);
+    testableModeReached = true;
+    onStart();
+
+    // Updates which have arrived in the meantime have been ignored by processUpdates(), hence process them now.
+    _started = true;
+    app.moduleExecutor.schedule(this);
+  }
+
+  /*********************************************************************************************************************/
+
+  void PooledApplicationModule::mainLoop() {
+    onStart();
+    auto group = readAnyGroup();
+    while(true) {
+      auto change = group.readAny();
+      onUpdate(change);
+    }
+  }
+
+  /*********************************************************************************************************************/
+
+  std::vector<cppext::future_queue<void>> PooledApplicationModule::getNotificationQueues() {
+    std::vector<cppext::future_queue<void>> queues;
+    for(auto& input : _pushInputs) {
+      queues.push_back(input.node.getAppAccessorNoType().getHighLevelImplElement()->getReadQueue());
+    }
+    return queues;
+  }
+
+  /*********************************************************************************************************************/
+
+  void PooledApplicationModule::processUpdates() {
+    // initial values are still being read by startupWrapper()
+    if(!_started) return;
+
+    // The MetaDataPropagatingRegisterDecorator updates the module's version number only for blocking reads, hence
+    // this is done here.
+    for(auto& input : _pushInputs) {
+      auto& accessor = input.node.getAppAccessorNoType();
+      while(accessor.readNonBlocking()) {
+        setCurrentVersionNumber(accessor.getVersionNumber());
+        onUpdate(accessor.getId());
+      }
+    }
+  }
+
+  /*********************************************************************************************************************/
+
+} /* namespace ChimeraTK */
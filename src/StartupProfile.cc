@@ -0,0 +1,76 @@
+#include "StartupProfile.h"
+
+#include <algorithm>
+#include <iomanip>
+
+namespace ChimeraTK {
+
+  /*********************************************************************************************************************/
+
+  StartupProfile::Phase& StartupProfile::get(const std::string& phase) {
+    auto it = std::find_if(_phases.begin(), _phases.end(), [&](const Phase& p) { return p.name == phase; });
+    if(it != _phases.end()) return *it;
+    _phases.emplace_back();
+    _phases.back().name = phase;
+    return _phases.back();
+  }
+
+  /*********************************************************************************************************************/
+
+  void StartupProfile::record(const std::string& phase, std::chrono::steady_clock::duration duration) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& p = get(phase);
+    p.recorded = true;
+    p.duration = std::chrono::duration<double, std::milli>(duration).count();
+    write(p);
+  }
+
+  /*********************************************************************************************************************/
+
+  void StartupProfile::declare(const std::string& phase) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    get(phase);
+  }
+
+  /*********************************************************************************************************************/
+
+  void StartupProfile::publish(const boost::shared_ptr<DevicePVManager>& pvManager, const std::string& path) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for(auto& phase : _phases) {
+      if(phase.processVariable) continue;
+      phase.processVariable = pvManager->createProcessArray<float>(SynchronizationDirection::devToCS,
+          path + "/" + phase.name, 1, "ms", "Duration of the startup phase " + phase.name);
+      if(phase.recorded) write(phase);
+    }
+  }
+
+  /*********************************************************************************************************************/
+
+  void StartupProfile::write(Phase& phase) {
+    if(!phase.processVariable) return;
+    phase.processVariable->accessData(0) = phase.duration;
+    phase.processVariable->write();
+  }
+
+  /*********************************************************************************************************************/
+
+  void StartupProfile::print(std::ostream& stream) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto flags = stream.flags();
+    auto precision = stream.precision();
+    size_t width = 0;
+    for(auto& phase : _phases) width = std::max(width, phase.name.size());
+    stream << "==== Startup profile ====" << std::endl;
+    for(auto& phase : _phases) {
+      if(!phase.recorded) continue;
+      stream << std::left << std::setw(int(width)) << phase.name << "  " << std::right << std::fixed
+             << std::setprecision(3) << std::setw(12) << phase.duration << " ms" << std::endl;
+    }
+    stream << "=========================" << std::endl;
+    stream.flags(flags);
+    stream.precision(precision);
+  }
+
+  /*********************************************************************************************************************/
+
+} /* namespace ChimeraTK */
@@ -0,0 +1,112 @@
+#include "TagIndex.h"
+
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <unordered_map>
+#include <vector>
+
+namespace ChimeraTK {
+
+  namespace {
+
+    /** Cached resolution of one tag expression */
+    struct Expression {
+      TagIndex::Match match;
+      bool literal{false};
+      std::unique_ptr<std::regex> regex; // only for non-literal expressions
+      size_t nTagsChecked{0};            // tags with IDs below this value have been matched already
+    };
+
+    struct Index {
+      std::mutex mutex;
+      std::unordered_map<std::string, size_t> ids;
+      std::vector<std::string> names;
+      std::unordered_map<std::string, Expression> expressions;
+    };
+
+    Index& getIndex() {
+      static Index index;
+      return index;
+    }
+
+    size_t internLocked(Index& index, const std::string& tag) {
+      auto it = index.ids.find(tag);
+      if(it != index.ids.end()) return it->second;
+      index.names.push_back(tag);
+      index.ids[tag] = index.names.size() - 1;
+      return index.names.size() - 1;
+    }
+
+  } // namespace
+
+  /*********************************************************************************************************************/
+
+  bool TagIndex::Match::operator()(const TagSet& nodeTags) const {
+    if(nodeTags.none()) return matchesUntagged;
+    for(auto id = nodeTags.find_first(); id != TagSet::npos; id = nodeTags.find_next(id)) {
+      if(id < tags.size() && tags.test(id)) return true;
+    }
+    return false;
+  }
+
+  /*********************************************************************************************************************/
+
+  size_t TagIndex::intern(const std::string& tag) {
+    auto& index = getIndex();
+    std::lock_guard<std::mutex> lock(index.mutex);
+    return internLocked(index, tag);
+  }
+
+  /*********************************************************************************************************************/
+
+  void TagIndex::addToSet(TagSet& set, const std::string& tag) {
+    auto id = intern(tag);
+    if(set.size() <= id) set.resize(id + 1);
+    set.set(id);
+  }
+
+  /*********************************************************************************************************************/
+
+  TagIndex::Match TagIndex::match(const std::string& expression) {
+    auto& index = getIndex();
+    std::lock_guard<std::mutex> lock(index.mutex);
+
+    auto it = index.expressions.find(expression);
+    if(it == index.expressions.end()) {
+      // build the entry completely before inserting it, so an invalid regex does not leave a broken entry behind
+      Expression e;
+      e.literal = expression.find_first_of("\\^$.|?*+()[]{}") == std::string::npos;
+      if(e.literal) {
+        e.match.matchesUntagged = expression.empty();
+        if(!expression.empty()) {
+          // the ID must exist so nodes tagged later are found through the same ID
+          auto id = internLocked(index, expression);
+          e.match.tags.resize(id + 1);
+          e.match.tags.set(id);
+        }
+        e.nTagsChecked = index.names.size();
+      }
+      else {
+        e.regex = std::make_unique<std::regex>(expression); // throws std::regex_error if invalid
+        e.match.matchesUntagged = std::regex_match("", *e.regex);
+      }
+      it = index.expressions.emplace(expression, std::move(e)).first;
+    }
+
+    // match tags interned since the last use of this expression
+    auto& e = it->second;
+    if(!e.literal && e.nTagsChecked < index.names.size()) {
+      e.match.tags.resize(index.names.size());
+      for(size_t id = e.nTagsChecked; id < index.names.size(); ++id) {
+        if(std::regex_match(index.names[id], *e.regex)) e.match.tags.set(id);
+      }
+      e.nTagsChecked = index.names.size();
+    }
+
+    return e.match;
+  }
+
+  /*********************************************************************************************************************/
+
+} /* namespace ChimeraTK */
@@ -310,6 +310,14 @@ namespace ChimeraTK {
 
   /*********************************************************************************************************************/
 
+  size_t VariableNetwork::getQueueLength() const {
+    size_t length = Application::getInstance().getDefaultQueueLength();
+    for(auto& n : nodeList) length = std::max(length, n.getQueueLength());
+    return length;
+  }
+
+  /*********************************************************************************************************************/
+
   bool VariableNetwork::merge(VariableNetwork& other) {
     // check if merging is possible
     if(hasFeedingNode() && other.hasFeedingNode()) {
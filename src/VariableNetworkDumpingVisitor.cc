@@ -41,6 +41,9 @@ namespace ChimeraTK {
       if(t.getFeedingNode().hasExternalTrigger()) {
         stream() << _prefix << "  external trigger node: ";
         t.getFeedingNode().getExternalTrigger().accept(*this);
+        if(t.getFeedingNode().getTriggerPrescaler() > 1) {
+          stream() << _prefix << "  trigger prescaler: " << t.getFeedingNode().getTriggerPrescaler() << std::endl;
+        }
       }
     }
     stream() << _prefix << "}" << std::endl;
@@ -47,6 +47,7 @@ namespace ChimeraTK {
     pdata->nElements = nElements;
     pdata->description = description;
     pdata->tags = tags;
+    for(auto& tag : tags) TagIndex::addToSet(pdata->tagIds, tag);
   }
 
   /*********************************************************************************************************************/
@@ -96,6 +97,30 @@ namespace ChimeraTK {
 
   /*********************************************************************************************************************/
 
+  VariableNetworkNode VariableNetworkNode::makeTimer(std::chrono::nanoseconds period) {
+    if(period.count() <= 0) {
+      throw ChimeraTK::logic_error("The period of a timer must be positive.");
+    }
+    VariableNetworkNode node;
+    node.pdata->type = NodeType::Timer;
+    node.pdata->mode = UpdateMode::push;
+    node.pdata->direction = {VariableDirection::feeding, false};
+    node.pdata->valueType = &typeid(uint64_t);
+    node.pdata->nElements = 1;
+    node.pdata->timerPeriod = period;
+    node.pdata->name = "*TIMER " + std::to_string(period.count()) + "ns*";
+    return node;
+  }
+
+  /*********************************************************************************************************************/
+
+  std::chrono::nanoseconds VariableNetworkNode::getTimerPeriod() const {
+    assert(pdata->type == NodeType::Timer);
+    return pdata->timerPeriod;
+  }
+
+  /*********************************************************************************************************************/
+
   VariableNetworkNode::VariableNetworkNode() : pdata(boost::make_shared<VariableNetworkNode_data>()) {}
 
   /*********************************************************************************************************************/
@@ -114,7 +139,7 @@ namespace ChimeraTK {
 
   bool VariableNetworkNode::hasImplementation() const {
     return pdata->type == NodeType::Device || pdata->type == NodeType::ControlSystem ||
-        pdata->type == NodeType::Constant;
+        pdata->type == NodeType::Constant || pdata->type == NodeType::Timer;
   }
 
   /*********************************************************************************************************************/
@@ -190,6 +215,14 @@ namespace ChimeraTK {
   /*********************************************************************************************************************/
 
   VariableNetworkNode VariableNetworkNode::operator[](VariableNetworkNode trigger) {
+    return operator[](PrescaledTrigger{trigger, 1});
+  }
+
+  /*********************************************************************************************************************/
+
+  VariableNetworkNode VariableNetworkNode::operator[](const PrescaledTrigger& prescaledTrigger) {
+    auto trigger = prescaledTrigger.trigger;
+
     // check if node already has a trigger
     if(pdata->externalTrigger.getType() != NodeType::invalid) {
       throw ChimeraTK::logic_error("Only one external trigger per variable network is allowed.");
@@ -205,11 +238,16 @@ namespace ChimeraTK {
 
     // check if already existing in map
     if(pdata->nodeWithTrigger.count(trigger) > 0) {
+      if(pdata->nodeWithTrigger[trigger].pdata->triggerPrescaler != prescaledTrigger.prescaler) {
+        throw ChimeraTK::logic_error("The variable '" + getName() +
+            "' cannot be triggered by the same trigger with different prescalers.");
+      }
       return pdata->nodeWithTrigger[trigger];
     }
 
     // create copy of the node
     pdata->nodeWithTrigger[trigger].pdata = boost::make_shared<VariableNetworkNode_data>(*pdata);
+    pdata->nodeWithTrigger[trigger].pdata->triggerPrescaler = prescaledTrigger.prescaler;
 
     // add ourselves as a trigger receiver to the other network
     if(!trigger.hasOwner()) {
@@ -226,6 +264,19 @@ namespace ChimeraTK {
 
   /*********************************************************************************************************************/
 
+  PrescaledTrigger VariableNetworkNode::every(size_t n) const {
+    if(n == 0) {
+      throw ChimeraTK::logic_error("The trigger prescaler for '" + getName() + "' must not be 0.");
+    }
+    return {*this, n};
+  }
+
+  /*********************************************************************************************************************/
+
+  size_t VariableNetworkNode::getTriggerPrescaler() const { return pdata->triggerPrescaler; }
+
+  /*********************************************************************************************************************/
+
   void VariableNetworkNode::setValueType(const std::type_info& newType) const {
     assert(*pdata->valueType == typeid(AnyType));
     pdata->valueType = &newType;
@@ -349,6 +400,28 @@ namespace ChimeraTK {
 
   /*********************************************************************************************************************/
 
+  void VariableNetworkNode::setQueueLength(size_t length) {
+    if(length == 1) {
+      throw ChimeraTK::logic_error("VariableNetworkNode::setQueueLength(): The queue length must be at least 2 (or 0 "
+                                   "for no request).");
+    }
+    pdata->queueLength = length;
+  }
+
+  /*********************************************************************************************************************/
+
+  size_t VariableNetworkNode::getQueueLength() const { return pdata->queueLength; }
+
+  /*********************************************************************************************************************/
+
+  void VariableNetworkNode::setConflating(bool conflating) { pdata->conflating = conflating; }
+
+  /*********************************************************************************************************************/
+
+  bool VariableNetworkNode::isConflating() const { return pdata->conflating; }
+
+  /*********************************************************************************************************************/
+
   ChimeraTK::TransferElementAbstractor& VariableNetworkNode::getAppAccessorNoType() const { return *(pdata->appNode); }
 
   /*********************************************************************************************************************/
@@ -371,11 +444,16 @@ namespace ChimeraTK {
       const std::string& description, const std::unordered_set<std::string>& tags) {
     setMetaData(name, unit, description);
     pdata->tags = tags;
+    pdata->tagIds.reset();
+    for(auto& tag : tags) TagIndex::addToSet(pdata->tagIds, tag);
   }
 
   /*********************************************************************************************************************/
 
-  void VariableNetworkNode::addTag(const std::string& tag) { pdata->tags.insert(tag); }
+  void VariableNetworkNode::addTag(const std::string& tag) {
+    pdata->tags.insert(tag);
+    TagIndex::addToSet(pdata->tagIds, tag);
+  }
 
   /*********************************************************************************************************************/
 
@@ -443,6 +521,10 @@ namespace ChimeraTK {
 
   /*********************************************************************************************************************/
 
+  const TagIndex::TagSet& VariableNetworkNode::getTagIds() const { return pdata->tagIds; }
+
+  /*********************************************************************************************************************/
+
   void VariableNetworkNode::setAppAccessorPointer(ChimeraTK::TransferElementAbstractor* accessor) {
     assert(getType() == NodeType::Application);
     pdata->appNode = accessor;
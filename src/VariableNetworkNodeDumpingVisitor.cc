@@ -15,6 +15,7 @@ namespace ChimeraTK {
       stream() << " type = Device (" << t.getDeviceAlias() << ": " << t.getRegisterName() << ")";
     if(t.getType() == NodeType::TriggerReceiver) stream() << " type = TriggerReceiver";
     if(t.getType() == NodeType::Constant) stream() << " type = Constant";
+    if(t.getType() == NodeType::Timer) stream() << " type = Timer (" << t.getTimerPeriod().count() << " ns)";
     if(t.getType() == NodeType::invalid) stream() << " type = **invalid**";
 
     if(t.getMode() == UpdateMode::push) stream() << _separator << "pushing";
@@ -0,0 +1,73 @@
+/* Benchmark of Application::initialise() for synthetic applications with many triggered device variables. This is
+ * not a unit test and hence not run by ctest. */
+
+#include <chrono>
+#include <iostream>
+
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "DeviceModule.h"
+#include "ScalarAccessor.h"
+
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+constexpr size_t nRegisters{4};
+constexpr size_t nVariablesPerTrigger{50};
+
+/*********************************************************************************************************************/
+/* Module with a configurable number of inputs and trigger outputs */
+
+struct SyntheticModule : public ctk::ApplicationModule {
+  SyntheticModule(EntityOwner* owner, const std::string& name, size_t nVariables)
+  : ApplicationModule(owner, name, "") {
+    for(size_t i = 0; i < nVariables; ++i) {
+      input.push_back(ctk::ScalarPushInput<int32_t>(this, "input" + std::to_string(i), "", "Input"));
+    }
+    for(size_t i = 0; i < nVariables / nVariablesPerTrigger; ++i) {
+      trigger.push_back(ctk::ScalarOutput<int32_t>(this, "trigger" + std::to_string(i), "", "Trigger"));
+    }
+  }
+
+  std::vector<ctk::ScalarPushInput<int32_t>> input;
+  std::vector<ctk::ScalarOutput<int32_t>> trigger;
+
+  void mainLoop() override {}
+};
+
+/*********************************************************************************************************************/
+/* Application connecting each input to a device register with an external trigger. Each connection creates its own
+ * network first, networks with the same register and trigger are merged by Application::optimiseConnections(). */
+
+struct SyntheticApplication : public ctk::Application {
+  SyntheticApplication(size_t nVariables) : Application("benchmarkInitialise"), module(this, "Module", nVariables) {}
+  ~SyntheticApplication() { shutdown(); }
+
+  void defineConnections() {
+    for(size_t i = 0; i < module.input.size(); ++i) {
+      dev("REG" + std::to_string(i % nRegisters + 1))[module.trigger[i % module.trigger.size()]] >> module.input[i];
+    }
+  }
+
+  ctk::DeviceModule dev{this, "(dummy?map=test.map)"};
+  SyntheticModule module;
+};
+
+/*********************************************************************************************************************/
+
+int main() {
+  for(size_t nVariables : {10000, 50000, 100000}) {
+    SyntheticApplication app(nVariables);
+    auto pvManagers = ctk::createPVManager();
+    app.setPVManager(pvManagers.second);
+    auto t0 = std::chrono::steady_clock::now();
+    app.initialise();
+    auto t1 = std::chrono::steady_clock::now();
+    std::cout << "nVariables = " << nVariables << ": initialise() took "
+              << std::chrono::duration<double>(t1 - t0).count() << " s" << std::endl;
+  }
+  return 0;
+}
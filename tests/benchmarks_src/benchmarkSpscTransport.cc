@@ -0,0 +1,100 @@
+/* Benchmark comparing the throughput and latency of the SpscAccessor with the ProcessArray. This is not a unit test
+ * and hence not run by ctest. */
+
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+#include <ChimeraTK/ControlSystemAdapter/ProcessArray.h>
+
+#include "SpscAccessor.h"
+
+namespace ctk = ChimeraTK;
+
+using Pair = std::pair<boost::shared_ptr<ctk::NDRegisterAccessor<int32_t>>,
+    boost::shared_ptr<ctk::NDRegisterAccessor<int32_t>>>;
+
+/*********************************************************************************************************************/
+
+Pair createProcessArrayPair(size_t nElements, size_t length) {
+  return ctk::createSynchronizedProcessArray<int32_t>(
+      nElements, "var", "", "", {}, length, {ctk::AccessMode::wait_for_new_data});
+}
+
+Pair createSpscPair(size_t nElements, size_t length) {
+  return ctk::createSpscVariable<int32_t>(nElements, "var", "", "", length);
+}
+
+/*********************************************************************************************************************/
+
+/* Send nMessages from one thread to another as fast as possible, return messages per second */
+double measureThroughput(Pair pair, size_t nMessages) {
+  auto& sender = pair.first;
+  auto& receiver = pair.second;
+
+  auto t0 = std::chrono::steady_clock::now();
+  std::thread consumer([&] {
+    for(size_t i = 0; i < nMessages; ++i) {
+      receiver->read();
+      if(receiver->accessData(0) == -1) break;
+    }
+  });
+  for(size_t i = 0; i < nMessages; ++i) {
+    sender->accessData(0) = int32_t(i);
+    sender->write();
+  }
+  // make sure the consumer terminates even if data was lost
+  while(true) {
+    sender->accessData(0) = -1;
+    if(!sender->write()) break;
+  }
+  consumer.join();
+  auto t1 = std::chrono::steady_clock::now();
+  return nMessages / std::chrono::duration<double>(t1 - t0).count();
+}
+
+/*********************************************************************************************************************/
+
+/* Ping-pong between two threads, return the mean one-way latency in microseconds */
+double measureLatency(Pair ping, Pair pong, size_t nRoundTrips) {
+  std::thread echo([&] {
+    for(size_t i = 0; i < nRoundTrips; ++i) {
+      ping.second->read();
+      pong.first->accessData(0) = ping.second->accessData(0);
+      pong.first->write();
+    }
+  });
+  auto t0 = std::chrono::steady_clock::now();
+  for(size_t i = 0; i < nRoundTrips; ++i) {
+    ping.first->accessData(0) = int32_t(i);
+    ping.first->write();
+    pong.second->read();
+    if(pong.second->accessData(0) != int32_t(i)) {
+      echo.detach();
+      throw std::runtime_error("measureLatency(): received wrong value in round trip " + std::to_string(i));
+    }
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  echo.join();
+  return std::chrono::duration<double, std::micro>(t1 - t0).count() / nRoundTrips / 2;
+}
+
+/*********************************************************************************************************************/
+
+int main() {
+  const size_t nMessages = 200000;
+  const size_t nRoundTrips = 20000;
+
+  for(size_t nElements : {1, 1000}) {
+    double tpPA = measureThroughput(createProcessArrayPair(nElements, 3), nMessages);
+    double tpSpsc = measureThroughput(createSpscPair(nElements, 3), nMessages);
+    double latPA = measureLatency(createProcessArrayPair(nElements, 3), createProcessArrayPair(nElements, 3), nRoundTrips);
+    double latSpsc = measureLatency(createSpscPair(nElements, 3), createSpscPair(nElements, 3), nRoundTrips);
+
+    std::cout << "nElements = " << nElements << std::endl;
+    std::cout << "  ProcessArray:  " << tpPA << " messages/s, " << latPA << " us latency" << std::endl;
+    std::cout << "  SpscAccessor:  " << tpSpsc << " messages/s, " << latSpsc << " us latency" << std::endl;
+  }
+  return 0;
+}
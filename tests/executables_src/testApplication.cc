@@ -17,11 +17,15 @@
 
 #include <libxml++/libxml++.h>
 
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+
 #include "Application.h"
 #include "ControlSystemModule.h"
 #include "Multiplier.h"
 #include "Pipe.h"
 
+#include "check_timeout.h"
+
 using namespace boost::unit_test_framework;
 namespace ctk = ChimeraTK;
 
@@ -249,3 +253,48 @@ BOOST_AUTO_TEST_CASE(testXmlGeneration) {
   BOOST_CHECK(found_myVarSOut);
   BOOST_CHECK(found_myVarU8);
 }
+
+/*********************************************************************************************************************/
+/* test the startup profile */
+
+BOOST_AUTO_TEST_CASE(testStartupProfile) {
+  std::cout << "***************************************************************"
+               "******************************************************"
+            << std::endl;
+  std::cout << "==> testStartupProfile" << std::endl;
+
+  TestApp app("testApp");
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.publishStartupProfile();
+  app.initialise();
+
+  // the process variables for all phases exist after initialise(), including those measured later
+  auto initialise = pvManagers.first->getProcessArray<float>("/Application/startupProfile/initialise/total");
+  auto prepare = pvManagers.first->getProcessArray<float>("/Application/startupProfile/run/prepare");
+  auto module = pvManagers.first->getProcessArray<float>("/Application/startupProfile/modules/testApp/multiplierD");
+  BOOST_REQUIRE(initialise);
+  BOOST_REQUIRE(prepare);
+  BOOST_REQUIRE(module);
+  BOOST_CHECK(initialise->readLatest());
+  BOOST_CHECK(initialise->accessData(0) >= 0);
+  BOOST_CHECK(!prepare->readNonBlocking());
+
+  // the process variables can only be created during initialise()
+  BOOST_CHECK_THROW(app.publishStartupProfile(), ctk::logic_error);
+
+  app.run();
+  BOOST_CHECK(prepare->readLatest());
+
+  // the module with unconnected input receives its initial value immediately
+  CHECK_TIMEOUT(module->readLatest(), 10000);
+
+  std::stringstream profile;
+  app.printStartupProfile(profile);
+  std::cout << profile.str();
+  for(auto phase : {"initialise/defineConnections", "initialise/optimiseConnections",
+          "initialise/makeConnectionsForNetwork", "run/prepare", "run/total", "initialise/total",
+          "modules/testApp/multiplierD"}) {
+    BOOST_CHECK(profile.str().find(std::string(phase) + " ") != std::string::npos);
+  }
+}
@@ -0,0 +1,107 @@
+#define BOOST_TEST_MODULE testConflatingVariables
+
+#include <boost/test/included/unit_test.hpp>
+#include <boost/thread/barrier.hpp>
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "ScalarAccessor.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+struct Producer : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarOutput<int> out{this, "out", "", "Output"};
+
+  void mainLoop() override {}
+};
+
+/*********************************************************************************************************************/
+
+struct Consumer : public ctk::ApplicationModule {
+  Consumer(EntityOwner* owner, const std::string& name, bool conflating)
+  : ApplicationModule(owner, name, ""), mainLoopStarted(2) {
+    in.setConflating(conflating);
+  }
+
+  ctk::ScalarPushInput<int> in{this, "in", "", "Input"};
+
+  boost::barrier mainLoopStarted;
+
+  void mainLoop() override { mainLoopStarted.wait(); }
+};
+
+/*********************************************************************************************************************/
+
+struct TestApplication : public ctk::Application {
+  TestApplication(bool conflating) : Application("testSuite"), consumer(this, "Consumer", conflating) {}
+  ~TestApplication() { shutdown(); }
+
+  void defineConnections() { producer.out >> consumer.in; }
+
+  Producer producer{this, "Producer", ""};
+  Consumer consumer;
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testLatestValueOnly) {
+  std::cout << "*** testLatestValueOnly" << std::endl;
+
+  TestApplication app(true);
+  app.initialise();
+  app.run();
+
+  // initial value
+  app.producer.out = 0;
+  app.producer.out.write();
+  app.consumer.mainLoopStarted.wait();
+  BOOST_CHECK_EQUAL(int(app.consumer.in), 0);
+  ctk::Application::getAndResetDataLossCounter();
+
+  // write many times without reading: only the last value is received, no data loss is reported
+  for(int i = 1; i <= 100; ++i) {
+    app.producer.out = i;
+    BOOST_CHECK(app.producer.out.write() == false);
+  }
+  app.consumer.in.read();
+  BOOST_CHECK_EQUAL(int(app.consumer.in), 100);
+  BOOST_CHECK(app.consumer.in.readNonBlocking() == false);
+  BOOST_CHECK_EQUAL(ctk::Application::getAndResetDataLossCounter(), 0);
+
+  // the version number is transported along with the value
+  ctk::VersionNumber version;
+  app.producer.setCurrentVersionNumber(version);
+  app.producer.out = 42;
+  app.producer.out.write();
+  BOOST_CHECK(app.consumer.in.readNonBlocking() == true);
+  BOOST_CHECK_EQUAL(int(app.consumer.in), 42);
+  BOOST_CHECK(app.consumer.in.getVersionNumber() == version);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testQueuedForComparison) {
+  std::cout << "*** testQueuedForComparison" << std::endl;
+
+  TestApplication app(false);
+  app.initialise();
+  app.run();
+
+  app.producer.out = 0;
+  app.producer.out.write();
+  app.consumer.mainLoopStarted.wait();
+  ctk::Application::getAndResetDataLossCounter();
+
+  for(int i = 1; i <= 100; ++i) {
+    app.producer.out = i;
+    app.producer.out.write();
+  }
+  app.consumer.in.read();
+  BOOST_CHECK(int(app.consumer.in) != 100);
+  BOOST_CHECK(ctk::Application::getAndResetDataLossCounter() > 0);
+}
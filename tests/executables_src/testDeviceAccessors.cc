@@ -19,6 +19,7 @@
 #include "Application.h"
 #include "ApplicationModule.h"
 #include "DeviceModule.h"
+#include "FusedDeviceAccessorDecorator.h"
 #include "ScalarAccessor.h"
 #include "TestFacility.h"
 
@@ -608,3 +609,49 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(testConnectTo2, T, test_types) {
   also.read();
   BOOST_CHECK_EQUAL(T(also), 12);
 }
+
+/*********************************************************************************************************************/
+/* test that device accessors directly connected to an application accessor use a single fused decorator outside the
+ * testable mode */
+
+BOOST_AUTO_TEST_CASE(testFusedDecorator) {
+  std::cout << "testFusedDecorator" << std::endl;
+
+  ChimeraTK::BackendFactory::getInstance().setDMapFilePath("test.dmap");
+
+  TestApplication<int32_t> app;
+
+  app.dev("/MyModule/actuator") >> app.testModule.consumingPoll;
+  app.testModule.feedingToDevice >> app.dev["MyModule"]("readBack");
+  ChimeraTK::Device dev;
+  dev.open("Dummy0");
+  auto regacc = dev.getScalarRegisterAccessor<int32_t>("/MyModule/actuator");
+  auto regrb = dev.getScalarRegisterAccessor<int32_t>("/MyModule/readBack");
+  regacc = 1;
+  regacc.write();
+
+  app.initialise();
+  app.run();
+
+  for(auto* accessor : std::vector<ctk::TransferElementAbstractor*>{
+          &app.testModule.consumingPoll, &app.testModule.feedingToDevice}) {
+    BOOST_CHECK(boost::dynamic_pointer_cast<ctk::FusedDeviceAccessorDecorator<int32_t>>(
+        accessor->getHighLevelImplElement()));
+    for(auto& elem : accessor->getInternalElements()) {
+      BOOST_CHECK(!boost::dynamic_pointer_cast<ctk::MetaDataPropagatingRegisterDecorator<int32_t>>(elem));
+    }
+  }
+
+  app.testModule.consumingPoll.read();
+  BOOST_CHECK_EQUAL(int32_t(app.testModule.consumingPoll), 1);
+  BOOST_CHECK(app.testModule.consumingPoll.dataValidity() == ctk::DataValidity::ok);
+  regacc = 42;
+  regacc.write();
+  app.testModule.consumingPoll.read();
+  BOOST_CHECK_EQUAL(int32_t(app.testModule.consumingPoll), 42);
+
+  app.testModule.feedingToDevice = 120;
+  app.testModule.feedingToDevice.write();
+  // the device might still be in recovery, in which case the value is written by the recovery
+  CHECK_TIMEOUT((regrb.read(), regrb == 120), 10000);
+}
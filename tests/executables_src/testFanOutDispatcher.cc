@@ -0,0 +1,113 @@
+#define BOOST_TEST_MODULE testFanOutDispatcher
+
+#include <chrono>
+#include <future>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <ChimeraTK/BackendFactory.h>
+#include <ChimeraTK/ExceptionDummyBackend.h>
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "ControlSystemModule.h"
+#include "DeviceModule.h"
+#include "ScalarAccessor.h"
+#include "TestFacility.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+constexpr char exceptionDummyCDD[] = "(ExceptionDummy:1?map=test.map)";
+
+/*********************************************************************************************************************/
+
+struct TestModule : ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<int> fromCS{this, "fromCS", "", ""};
+  ctk::ScalarPushInput<int> fromDevice{this, "fromDevice", "", ""};
+
+  std::promise<void> mainLoopStarted;
+
+  // the inputs are read by the test, once the initial values have been received
+  void mainLoop() override { mainLoopStarted.set_value(); }
+};
+
+/*********************************************************************************************************************/
+
+/* Application with one fan-out fed by the control system and one fed by a push-type device register. Each fan-out
+ * distributes to both modules. */
+struct TestApplication : ctk::Application {
+  TestApplication() : Application("testSuite") { enableFanOutDispatcher(2); }
+  ~TestApplication() { shutdown(); }
+
+  void defineConnections() {
+    cs("csVar", typeid(int), 1) >> module1.fromCS >> module2.fromCS;
+    dev("REG1/PUSH_READ", typeid(int), 1, ctk::UpdateMode::push) >> module1.fromDevice >> module2.fromDevice;
+  }
+
+  ctk::ControlSystemModule cs;
+  ctk::DeviceModule dev{this, exceptionDummyCDD};
+  TestModule module1{this, "Module1", ""};
+  TestModule module2{this, "Module2", ""};
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testDispatchedFanOuts) {
+  std::cout << "*** testDispatchedFanOuts" << std::endl;
+
+  auto backend = boost::dynamic_pointer_cast<ctk::ExceptionDummy>(
+      ctk::BackendFactory::getInstance().createBackend(exceptionDummyCDD));
+  BOOST_REQUIRE(backend);
+  backend->open();
+  auto reg = backend->getRawAccessor("", "REG1");
+  auto writeRegister = [&](int value) {
+    auto lock = reg.getBufferLock();
+    reg = value;
+  };
+  writeRegister(7);
+
+  TestApplication app;
+  ctk::TestFacility test(false);
+  test.writeScalar("/csVar", 5);
+  app.run();
+
+  for(auto* module : {&app.module1, &app.module2}) {
+    auto started = module->mainLoopStarted.get_future();
+    BOOST_REQUIRE(started.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+  }
+
+  // the initial values have been distributed to all consumers
+  BOOST_CHECK_EQUAL(int(app.module1.fromCS), 5);
+  BOOST_CHECK_EQUAL(int(app.module2.fromCS), 5);
+  BOOST_CHECK_EQUAL(int(app.module1.fromDevice), 7);
+  BOOST_CHECK_EQUAL(int(app.module2.fromDevice), 7);
+
+  // each update is distributed to all consumers with the same version number
+  for(int i = 0; i < 10; ++i) {
+    test.writeScalar("/csVar", 100 + i);
+    writeRegister(200 + i);
+    backend->triggerPush(ctk::RegisterPath("REG1/PUSH_READ"));
+
+    for(auto* module : {&app.module1, &app.module2}) {
+      module->fromCS.read();
+      BOOST_CHECK_EQUAL(int(module->fromCS), 100 + i);
+      module->fromDevice.read();
+      BOOST_CHECK_EQUAL(int(module->fromDevice), 200 + i);
+    }
+    BOOST_CHECK(app.module1.fromCS.getVersionNumber() == app.module2.fromCS.getVersionNumber());
+    BOOST_CHECK(app.module1.fromDevice.getVersionNumber() == app.module2.fromDevice.getVersionNumber());
+  }
+
+  // no value has been distributed twice
+  for(auto* module : {&app.module1, &app.module2}) {
+    BOOST_CHECK(!module->fromCS.readNonBlocking());
+    BOOST_CHECK(!module->fromDevice.readNonBlocking());
+  }
+
+  // the destructor shuts down the application, which must stop the dispatcher and the fan-outs without hanging
+}
+
+/*********************************************************************************************************************/
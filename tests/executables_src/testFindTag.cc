@@ -7,6 +7,7 @@
 
 #include <chrono>
 #include <future>
+#include <regex>
 
 #define BOOST_TEST_MODULE testFindTag
 
@@ -180,3 +181,37 @@ BOOST_AUTO_TEST_CASE(testExcludeTag) {
         test.writeScalar<uint64_t>("/first/SecondModule/Var" + std::to_string(i), i), ChimeraTK::logic_error);
   }
 }
+
+/*********************************************************************************************************************/
+/* test searching with a regular expression again after new tags have been added */
+
+BOOST_AUTO_TEST_CASE(testRegexAfterNewTags) {
+  std::cout << "*****************************************************************************************" << std::endl;
+  std::cout << "==> testRegexAfterNewTags" << std::endl;
+
+  TestApplication app;
+  auto nPartial = app.findTag("Partial").getAccessorListRecursive().size();
+  BOOST_CHECK(nPartial > 0);
+  BOOST_CHECK_EQUAL(app.findTag("Par.*").getAccessorListRecursive().size(), nPartial);
+
+  // tags added after the expression has been used before must be matched as well
+  app.first.secondModule.myVec[0].addTag("ParNewTag");
+  app.first.secondModule.myVec[1].addTag("NotMatching");
+  BOOST_CHECK_EQUAL(app.findTag("Par.*").getAccessorListRecursive().size(), nPartial + 1);
+  BOOST_CHECK_EQUAL(app.findTag("ParNewTag").getAccessorListRecursive().size(), 1);
+  BOOST_CHECK_EQUAL(
+      app.excludeTag("Par.*").getAccessorListRecursive().size() + nPartial + 1, app.getAccessorListRecursive().size());
+}
+
+/*********************************************************************************************************************/
+/* test that an invalid regular expression is reported each time it is used */
+
+BOOST_AUTO_TEST_CASE(testInvalidRegex) {
+  std::cout << "*****************************************************************************************" << std::endl;
+  std::cout << "==> testInvalidRegex" << std::endl;
+
+  TestApplication app;
+  BOOST_CHECK_THROW(app.findTag("("), std::regex_error);
+  BOOST_CHECK_THROW(app.findTag("("), std::regex_error);
+  BOOST_CHECK_THROW(app.excludeTag("("), std::regex_error);
+}
@@ -0,0 +1,208 @@
+#define BOOST_TEST_MODULE testModuleExecutor
+
+#include <atomic>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <ChimeraTK/BackendFactory.h>
+#include <ChimeraTK/ControlSystemAdapter/ControlSystemPVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+#include <ChimeraTK/ExceptionDummyBackend.h>
+
+#include "Application.h"
+#include "ControlSystemModule.h"
+#include "DeviceModule.h"
+#include "PooledApplicationModule.h"
+#include "ScalarAccessor.h"
+#include "check_timeout.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+/* Module adding 1 to its input, executed either by the pool or in its own thread */
+
+struct Adder : public ctk::PooledApplicationModule {
+  using ctk::PooledApplicationModule::PooledApplicationModule;
+
+  ctk::ScalarPushInput<int> in{this, "in", "", "Input"};
+  ctk::ScalarOutput<int> out{this, "out", "", "Output"};
+
+  size_t nUpdates{0};
+
+  void onStart() override {
+    out = in + 1;
+    out.write();
+  }
+
+  void onUpdate(ctk::TransferElementID change) override {
+    BOOST_CHECK(change == in.getId());
+    ++nUpdates;
+    out = in + 1;
+    out.write();
+  }
+};
+
+/*********************************************************************************************************************/
+/* Application with a chain of Adders */
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") {
+    adders.reserve(nAdders);
+    for(size_t i = 0; i < nAdders; ++i) {
+      adders.emplace_back(this, "Adder" + std::to_string(i), "");
+    }
+  }
+  ~TestApplication() { shutdown(); }
+
+  void defineConnections() {
+    cs("in") >> adders.front().in;
+    for(size_t i = 0; i < nAdders - 1; ++i) {
+      adders[i].out >> adders[i + 1].in;
+    }
+    adders.back().out >> cs("out");
+  }
+
+  using Application::moduleExecutor;
+
+  static constexpr size_t nAdders{20};
+  std::vector<Adder> adders;
+  ctk::ControlSystemModule cs;
+};
+
+/*********************************************************************************************************************/
+
+void runChain(TestApplication& app, boost::shared_ptr<ctk::ControlSystemPVManager>& csManager) {
+  auto in = csManager->getProcessArray<int>("/in");
+  auto out = csManager->getProcessArray<int>("/out");
+
+  // initial value
+  in->accessData(0) = 0;
+  in->write();
+  CHECK_TIMEOUT((out->readLatest(), out->accessData(0) == int(TestApplication::nAdders)), 10000);
+
+  for(int i = 1; i < 100; ++i) {
+    in->accessData(0) = 1000 * i;
+    in->write();
+    CHECK_TIMEOUT((out->readLatest(), out->accessData(0) == 1000 * i + int(TestApplication::nAdders)), 10000);
+  }
+
+  for(auto& adder : app.adders) {
+    BOOST_CHECK_EQUAL(adder.nUpdates, 99U);
+  }
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testPooledExecution) {
+  std::cout << "*** testPooledExecution" << std::endl;
+
+  TestApplication app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.enableModuleExecutor(2);
+  app.initialise();
+  app.run();
+
+  BOOST_CHECK(app.moduleExecutor.isRunning());
+  BOOST_CHECK_EQUAL(app.moduleExecutor.getNumberOfThreads(), 2);
+
+  runChain(app, pvManagers.first);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testThreadedExecution) {
+  std::cout << "*** testThreadedExecution" << std::endl;
+
+  TestApplication app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  app.run();
+
+  BOOST_CHECK(!app.moduleExecutor.isRunning());
+
+  runChain(app, pvManagers.first);
+}
+
+/*********************************************************************************************************************/
+/* Module reading a poll-type input from a device */
+
+struct DevicePoller : public ctk::PooledApplicationModule {
+  using ctk::PooledApplicationModule::PooledApplicationModule;
+
+  ctk::ScalarPollInput<int> reg{this, "reg", "", "Device register"};
+
+  std::atomic<bool> started{false};
+
+  void onStart() override { started = true; }
+
+  void onUpdate(ctk::TransferElementID) override {}
+};
+
+/*********************************************************************************************************************/
+/* Application with more DevicePollers than worker threads, and an Adder independent of the device */
+
+struct FailingDeviceApplication : public ctk::Application {
+  FailingDeviceApplication() : Application("testSuite") {}
+  ~FailingDeviceApplication() { shutdown(); }
+
+  void defineConnections() {
+    cs("in") >> adder.in;
+    adder.out >> cs("out");
+    dev("REG1") >> poller1.reg;
+    dev("REG2") >> poller2.reg;
+    dev("REG3") >> poller3.reg;
+  }
+
+  static constexpr const char* deviceCDD{"(ExceptionDummy:1?map=test.map)"};
+  DevicePoller poller1{this, "Poller1", ""};
+  DevicePoller poller2{this, "Poller2", ""};
+  DevicePoller poller3{this, "Poller3", ""};
+  std::vector<DevicePoller*> pollers{&poller1, &poller2, &poller3};
+  Adder adder{this, "Adder", ""};
+  ctk::DeviceModule dev{this, deviceCDD};
+  ctk::ControlSystemModule cs;
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testFailingDevice) {
+  std::cout << "*** testFailingDevice" << std::endl;
+
+  auto backend = boost::dynamic_pointer_cast<ctk::ExceptionDummy>(
+      ctk::BackendFactory::getInstance().createBackend(FailingDeviceApplication::deviceCDD));
+  backend->throwExceptionOpen = true;
+
+  FailingDeviceApplication app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.enableModuleExecutor(2);
+  app.initialise();
+  app.run();
+
+  // More DevicePollers than workers wait for their initial values, which must not block the workers. Hence the Adder is running.
+  auto in = pvManagers.first->getProcessArray<int>("/in");
+  auto out = pvManagers.first->getProcessArray<int>("/out");
+  in->accessData(0) = 10;
+  in->write();
+  CHECK_TIMEOUT((out->readLatest(), out->accessData(0) == 11), 10000);
+  in->accessData(0) = 20;
+  in->write();
+  CHECK_TIMEOUT((out->readLatest(), out->accessData(0) == 21), 10000);
+  for(auto* poller : app.pollers) {
+    BOOST_CHECK(!poller->started);
+  }
+
+  // the DevicePollers start once the device has been opened
+  backend->throwExceptionOpen = false;
+  for(auto* poller : app.pollers) {
+    CHECK_TIMEOUT(poller->started, 10000);
+  }
+  in->accessData(0) = 30;
+  in->write();
+  CHECK_TIMEOUT((out->readLatest(), out->accessData(0) == 31), 10000);
+}
+
+/*********************************************************************************************************************/
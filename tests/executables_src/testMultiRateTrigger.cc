@@ -0,0 +1,114 @@
+#define BOOST_TEST_MODULE testMultiRateTrigger
+
+#include <map>
+
+#include <boost/test/included/unit_test.hpp>
+#include <boost/thread/barrier.hpp>
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "MultiRateTrigger.h"
+#include "ScalarAccessor.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+struct Receiver : public ctk::ApplicationModule {
+  Receiver(EntityOwner* owner, const std::string& name) : ApplicationModule(owner, name, ""), mainLoopStarted(2) {}
+
+  ctk::ScalarPushInput<uint64_t> fast{this, "fast", "", "Trigger input"};
+  ctk::ScalarPushInput<uint64_t> medium{this, "medium", "", "Trigger input"};
+  ctk::ScalarPushInput<uint64_t> slow{this, "slow", "", "Trigger input"};
+
+  boost::barrier mainLoopStarted;
+
+  void mainLoop() override { mainLoopStarted.wait(); }
+};
+
+/*********************************************************************************************************************/
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") {}
+  ~TestApplication() { shutdown(); }
+
+  void defineConnections() {
+    trigger.tick[0] >> receiver.fast;
+    trigger.tick[1] >> receiver.medium;
+    trigger.tick[2] >> receiver.slow;
+  }
+
+  ctk::MultiRateTrigger trigger{
+      this, "trigger", "", std::chrono::milliseconds(10), {{"fast", 1}, {"medium", 2}, {"slow", 5}}};
+  Receiver receiver{this, "Receiver"};
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testInvalidSettings) {
+  std::cout << "*** testInvalidSettings" << std::endl;
+
+  struct InvalidApplication : public ctk::Application {
+    InvalidApplication() : Application("testSuite") {}
+    ~InvalidApplication() { shutdown(); }
+  } app;
+
+  BOOST_CHECK_THROW(ctk::MultiRateTrigger(&app, "trigger", "", std::chrono::milliseconds(0), {{"fast", 1}}),
+      ctk::logic_error);
+  BOOST_CHECK_THROW(ctk::MultiRateTrigger(&app, "trigger", "", std::chrono::milliseconds(1), {{"fast", 0}}),
+      ctk::logic_error);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testPhaseLockedOutputs) {
+  std::cout << "*** testPhaseLockedOutputs" << std::endl;
+
+  TestApplication app;
+  app.initialise();
+  app.run();
+  app.receiver.mainLoopStarted.wait();
+
+  // the initial values, which are the reference for the first boundary crossings
+  uint64_t previousFast = app.receiver.fast;
+
+  // record all received ticks by version number
+  std::map<ctk::VersionNumber, uint64_t> fast, medium, slow;
+  ctk::ReadAnyGroup group{app.receiver.fast, app.receiver.medium, app.receiver.slow};
+  while(slow.size() < 4) {
+    auto id = group.readAny();
+    if(id == app.receiver.fast.getId()) fast[app.receiver.fast.getVersionNumber()] = app.receiver.fast;
+    if(id == app.receiver.medium.getId()) medium[app.receiver.medium.getVersionNumber()] = app.receiver.medium;
+    if(id == app.receiver.slow.getId()) slow[app.receiver.slow.getVersionNumber()] = app.receiver.slow;
+  }
+  BOOST_CHECK_EQUAL(ctk::Application::getAndResetDataLossCounter(), 0);
+
+  // Base ticks may be skipped if deadlines are missed, so only the following is guaranteed. The fast output has the
+  // divider 1 and hence fires on each base tick which is sent. Each output has the value of the base tick divided by
+  // its divider and fires together with the fast output, using the same version number.
+  for(auto& tick : medium) {
+    BOOST_REQUIRE(fast.count(tick.first) == 1);
+    BOOST_CHECK_EQUAL(tick.second, fast[tick.first] / 2);
+  }
+  for(auto& tick : slow) {
+    BOOST_REQUIRE(fast.count(tick.first) == 1);
+    BOOST_CHECK_EQUAL(tick.second, fast[tick.first] / 5);
+  }
+
+  // the values of each output increase strictly (the maps are ordered by version number)
+  for(auto* ticks : {&fast, &medium, &slow}) {
+    uint64_t previous = 0;
+    for(auto& tick : *ticks) {
+      BOOST_CHECK(tick.second > previous);
+      previous = tick.second;
+    }
+  }
+
+  // an output fires exactly when a multiple of its divider has been crossed since the previous base tick
+  for(auto& tick : fast) {
+    BOOST_CHECK_EQUAL(medium.count(tick.first), tick.second / 2 != previousFast / 2 ? 1U : 0U);
+    BOOST_CHECK_EQUAL(slow.count(tick.first), tick.second / 5 != previousFast / 5 ? 1U : 0U);
+    previousFast = tick.second;
+  }
+}
@@ -0,0 +1,102 @@
+#define BOOST_TEST_MODULE testOptimiseConnections
+
+#include <set>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "DeviceModule.h"
+#include "ScalarAccessor.h"
+#include "VariableNetwork.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+struct TestModule : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarOutput<int32_t> triggerA{this, "triggerA", "", "Trigger"};
+  ctk::ScalarOutput<int32_t> triggerB{this, "triggerB", "", "Trigger"};
+
+  ctk::ScalarPushInput<int32_t> in0{this, "in0", "", ""};
+  ctk::ScalarPushInput<int32_t> in1{this, "in1", "", ""};
+  ctk::ScalarPushInput<int32_t> in2{this, "in2", "", ""};
+  ctk::ScalarPushInput<int32_t> in3{this, "in3", "", ""};
+  ctk::ScalarPushInput<int32_t> in4{this, "in4", "", ""};
+  ctk::ScalarPushInput<int32_t> in5{this, "in5", "", ""};
+  ctk::ScalarPushInput<int32_t> in6{this, "in6", "", ""};
+
+  void mainLoop() override {}
+};
+
+/*********************************************************************************************************************/
+/* Each connection creates its own network, which are merged by Application::optimiseConnections() if they have the
+ * same register, trigger and prescaler. */
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") {}
+  ~TestApplication() { shutdown(); }
+
+  void defineConnections() {
+    dev("REG1")[module.triggerA] >> module.in0;
+    dev("REG1")[module.triggerA] >> module.in1;
+    dev("REG1")[module.triggerB] >> module.in2;
+    dev("REG1")[module.triggerA.every(2)] >> module.in3;
+    dev("REG2")[module.triggerA] >> module.in4;
+    dev("REG1")[module.triggerA] >> module.in5;
+    dev("REG1")[module.triggerA.every(2)] >> module.in6;
+  }
+
+  ctk::DeviceModule dev{this, "(dummy?map=test.map)"};
+  TestModule module{this, "Module", ""};
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testMergeTriggeredNetworks) {
+  std::cout << "*** testMergeTriggeredNetworks" << std::endl;
+
+  TestApplication app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+
+  auto& m = app.module;
+  auto owner = [](ctk::VariableNetworkNode node) { return &node.getOwner(); };
+
+  // same register, trigger and prescaler: one network
+  BOOST_CHECK(owner(m.in0) == owner(m.in1));
+  BOOST_CHECK(owner(m.in0) == owner(m.in5));
+  BOOST_CHECK(owner(m.in3) == owner(m.in6));
+
+  // different trigger, prescaler or register: separate networks
+  std::set<ctk::VariableNetwork*> networks{owner(m.in0), owner(m.in2), owner(m.in3), owner(m.in4)};
+  BOOST_CHECK_EQUAL(networks.size(), 4);
+
+  // the networks are merged into the last compatible network, the consumers of the earlier networks are appended in
+  // reverse order
+  auto consumers = owner(m.in0)->getConsumingNodes();
+  std::list<ctk::VariableNetworkNode> expectedConsumers{m.in5, m.in1, m.in0};
+  BOOST_CHECK(consumers == expectedConsumers);
+  consumers = owner(m.in3)->getConsumingNodes();
+  expectedConsumers = {m.in6, m.in3};
+  BOOST_CHECK(consumers == expectedConsumers);
+
+  // the merged networks keep their trigger and prescaler
+  auto feederA = owner(m.in0)->getFeedingNode();
+  BOOST_CHECK(feederA.getExternalTrigger() == ctk::VariableNetworkNode(m.triggerA));
+  BOOST_CHECK_EQUAL(feederA.getTriggerPrescaler(), 1);
+  auto feederB = owner(m.in2)->getFeedingNode();
+  BOOST_CHECK(feederB.getExternalTrigger() == ctk::VariableNetworkNode(m.triggerB));
+  auto feederPrescaled = owner(m.in3)->getFeedingNode();
+  BOOST_CHECK(feederPrescaled.getExternalTrigger() == ctk::VariableNetworkNode(m.triggerA));
+  BOOST_CHECK_EQUAL(feederPrescaled.getTriggerPrescaler(), 2);
+  BOOST_CHECK_EQUAL(owner(m.in4)->getFeedingNode().getRegisterName(), "REG2");
+}
+
+/*********************************************************************************************************************/
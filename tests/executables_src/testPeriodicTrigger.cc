@@ -0,0 +1,186 @@
+#define BOOST_TEST_MODULE testPeriodicTrigger
+
+#include <array>
+#include <chrono>
+#include <cmath>
+
+#include <boost/test/included/unit_test.hpp>
+#include <boost/thread/barrier.hpp>
+
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "ControlSystemModule.h"
+#include "PeriodicTrigger.h"
+#include "ScalarAccessor.h"
+
+#include "check_timeout.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+struct Receiver : public ctk::ApplicationModule {
+  Receiver(EntityOwner* owner, const std::string& name) : ApplicationModule(owner, name, ""), mainLoopStarted(2) {}
+
+  ctk::ScalarPushInput<uint64_t> tick{this, "tick", "", "Trigger input"};
+
+  boost::barrier mainLoopStarted;
+
+  void mainLoop() override { mainLoopStarted.wait(); }
+};
+
+/*********************************************************************************************************************/
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") {}
+  ~TestApplication() { shutdown(); }
+
+  void defineConnections() {
+    ctk::VariableNetworkNode::makeConstant<uint32_t>(true, 500) >> trigger.periodMicroseconds;
+    trigger.tick >> receiver.tick;
+    trigger.statistics.connectTo(cs["Statistics"]);
+  }
+
+  ctk::PeriodicTrigger trigger{this, "trigger", ""};
+  Receiver receiver{this, "Receiver"};
+  ctk::ControlSystemModule cs;
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testInvalidSettings) {
+  std::cout << "*** testInvalidSettings" << std::endl;
+
+  TestApplication app;
+  BOOST_CHECK_THROW(app.trigger.setRealtimePriority(100), ctk::logic_error);
+  BOOST_CHECK_THROW(app.trigger.setRealtimePriority(-1), ctk::logic_error);
+  BOOST_CHECK_THROW(app.trigger.setSpinThreshold(std::chrono::microseconds(-1)), ctk::logic_error);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testSkipMissedDeadlines) {
+  std::cout << "*** testSkipMissedDeadlines" << std::endl;
+
+  using std::chrono::microseconds;
+  const std::chrono::steady_clock::time_point start{std::chrono::seconds(100)};
+  const microseconds period(500);
+
+  // woken up in time or late by less than one period: nothing is skipped
+  for(auto delay : {microseconds(0), microseconds(1), microseconds(499)}) {
+    auto deadline = start;
+    BOOST_CHECK_EQUAL(ctk::DeadlineTimer::skipMissedDeadlines(deadline, start + delay, period), 0);
+    BOOST_CHECK(deadline == start);
+  }
+
+  // woken up before the deadline (should not happen, but must not skip)
+  auto deadline = start;
+  BOOST_CHECK_EQUAL(ctk::DeadlineTimer::skipMissedDeadlines(deadline, start - microseconds(1000), period), 0);
+  BOOST_CHECK(deadline == start);
+
+  // late by n full periods: n deadlines are skipped, the remaining latency is below one period
+  for(int64_t n : {1, 2, 3, 1000}) {
+    for(auto remainder : {microseconds(0), microseconds(1), microseconds(499)}) {
+      deadline = start;
+      auto now = start + n * period + remainder;
+      BOOST_CHECK_EQUAL(ctk::DeadlineTimer::skipMissedDeadlines(deadline, now, period), uint64_t(n));
+      BOOST_CHECK(deadline == start + n * period);
+      BOOST_CHECK(now - deadline == remainder);
+    }
+  }
+
+  // a period of 0 never skips
+  deadline = start;
+  BOOST_CHECK_EQUAL(ctk::DeadlineTimer::skipMissedDeadlines(deadline, start + microseconds(1000), microseconds(0)), 0);
+  BOOST_CHECK(deadline == start);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testLatencyStatistics) {
+  std::cout << "*** testLatencyStatistics" << std::endl;
+
+  using std::chrono::microseconds;
+  ctk::LatencyStatistics latency;
+  BOOST_CHECK_EQUAL(latency.count(), 0);
+  BOOST_CHECK_EQUAL(latency.mean(), 0.);
+  BOOST_CHECK_EQUAL(latency.jitter(), 0.);
+
+  latency.record(microseconds(2));
+  latency.record(microseconds(4));
+  latency.record(microseconds(6));
+  BOOST_CHECK_EQUAL(latency.count(), 3);
+  BOOST_CHECK_CLOSE(latency.mean(), 4., 1e-6);
+  BOOST_CHECK_CLOSE(latency.max(), 6., 1e-6);
+  BOOST_CHECK_CLOSE(latency.jitter(), std::sqrt(8. / 3.), 1e-6);
+
+  // bin 0 is below 1 us, bin i is [2^(i-1), 2^i) us, the last bin takes all longer delays
+  latency.record(std::chrono::nanoseconds(500));
+  latency.record(microseconds(1));
+  latency.record(microseconds(16383));
+  latency.record(microseconds(16384));
+  latency.record(std::chrono::seconds(1));
+  std::array<uint64_t, ctk::LatencyStatistics::nHistogramBins> expected{};
+  expected[0] = 1;  // 0.5 us
+  expected[1] = 1;  // 1 us
+  expected[2] = 1;  // 2 us
+  expected[3] = 2;  // 4 us, 6 us
+  expected[14] = 1; // 16383 us
+  expected[15] = 2; // 16384 us, 1 s
+  BOOST_CHECK(latency.histogram() == expected);
+
+  // reset clears mean, maximum and jitter, but the histogram covers all delays since the start
+  latency.reset();
+  BOOST_CHECK_EQUAL(latency.count(), 0);
+  BOOST_CHECK_EQUAL(latency.mean(), 0.);
+  BOOST_CHECK_EQUAL(latency.max(), 0.);
+  BOOST_CHECK_EQUAL(latency.jitter(), 0.);
+  BOOST_CHECK(latency.histogram() == expected);
+
+  latency.record(microseconds(10));
+  BOOST_CHECK_CLOSE(latency.mean(), 10., 1e-6);
+  BOOST_CHECK_CLOSE(latency.max(), 10., 1e-6);
+  BOOST_CHECK_SMALL(latency.jitter(), 1e-6);
+  ++expected[4];
+  BOOST_CHECK(latency.histogram() == expected);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testSubMillisecondPeriod) {
+  std::cout << "*** testSubMillisecondPeriod" << std::endl;
+
+  TestApplication app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.trigger.setSpinThreshold(std::chrono::microseconds(100));
+  app.initialise();
+  app.run();
+  app.receiver.mainLoopStarted.wait();
+
+  // 1000 ticks at 500 us take at least 500 ms. Missed ticks are skipped, so they make it take longer.
+  app.receiver.tick.read();
+  uint64_t firstTick = app.receiver.tick;
+  auto t0 = std::chrono::steady_clock::now();
+  while(app.receiver.tick < firstTick + 1000) app.receiver.tick.read();
+  auto t1 = std::chrono::steady_clock::now();
+  std::cout << "1000 ticks took " << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms" << std::endl;
+  BOOST_CHECK(t1 - t0 >= std::chrono::microseconds(499000));
+  // generous upper bound, only to detect a trigger which is much too slow (e.g. millisecond instead of microsecond
+  // period). The skipping of missed ticks is tested deterministically in testSkipMissedDeadlines.
+  BOOST_CHECK(t1 - t0 < std::chrono::seconds(20));
+
+  // the statistics are published once per second
+  auto histogram = pvManagers.first->getProcessArray<uint64_t>("/Statistics/latencyHistogram");
+  auto latencyMax = pvManagers.first->getProcessArray<float>("/Statistics/latencyMax");
+  auto missedTicks = pvManagers.first->getProcessArray<uint64_t>("/Statistics/missedTicks");
+  CHECK_TIMEOUT((histogram->readLatest(), histogram->accessChannel(0) != std::vector<uint64_t>(16, 0)), 10000);
+  latencyMax->readLatest();
+  missedTicks->readLatest();
+  std::cout << "Maximum latency: " << latencyMax->accessData(0) << " us, missed ticks: " << missedTicks->accessData(0)
+            << std::endl;
+  BOOST_CHECK(latencyMax->accessData(0) >= 0);
+}
@@ -13,6 +13,7 @@
 #include <ChimeraTK/ExceptionDummyBackend.h>
 #include <ChimeraTK/Device.h>
 #include <stdlib.h>
+#include <future>
 #include <regex>
 #include <boost/thread/barrier.hpp>
 
@@ -136,9 +137,9 @@ BOOST_AUTO_TEST_CASE(testWriteToReadOnly) {
 
 /*********************************************************************************************************************/
 
-BOOST_AUTO_TEST_CASE(testProcessVariableRecovery) {
-  std::cout << "testProcessVariableRecovery" << std::endl;
+void testRecovery(bool orderedRecovery) {
   TestApplication app;
+  app.dev.setOrderedRecovery(orderedRecovery);
 
   app.findTag(".*").connectTo(app.cs); // creates /TEST/TO_DEV_SCALAR1 and /TEST/TO/DEV/ARRAY1
   // devices are not automatically connected (yet)
@@ -234,4 +235,111 @@ BOOST_AUTO_TEST_CASE(testProcessVariableRecovery) {
 
   // check if the constant is written back after recovery
   CHECK_EQUAL_TIMEOUT(dummy.read<int32_t>("/CONSTANT/VAR32"), 44252, 10000);
+
+  // the time needed for writing the recovery values is published
+  BOOST_CHECK(test.readScalar<float>(ctk::RegisterPath("/Devices") / deviceCDD / "recoveryDuration") >= 0.);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testProcessVariableRecovery) {
+  std::cout << "testProcessVariableRecovery" << std::endl;
+  testRecovery(true);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testUnorderedRecovery) {
+  std::cout << "testUnorderedRecovery" << std::endl;
+  // all recovery accessors are valid in the recovery after the exception, so they are written through a TransferGroup
+  testRecovery(false);
+}
+
+/*********************************************************************************************************************/
+
+/* Application writing an array destructively to the device. The accessors are used by the test thread once the
+ * mainLoop has been entered. */
+struct DestructiveWriteApplication : public ctk::Application {
+  DestructiveWriteApplication() : Application("testSuite") {}
+  ~DestructiveWriteApplication() { shutdown(); }
+
+  void defineConnections() {
+    module.arrayOutput >> dev["TEST"]("TO_DEV_ARRAY1");
+    dev["TEST"]("FROM_DEV_SCALAR1") >> module.scalarInput;
+  }
+
+  ctk::DeviceModule dev{this, deviceCDD};
+
+  struct TestModule : public ctk::ApplicationModule {
+    using ctk::ApplicationModule::ApplicationModule;
+
+    ctk::ArrayOutput<int32_t> arrayOutput{this, "TO_DEV_ARRAY1", "", 4, "Here I write an array"};
+    ctk::ScalarPollInput<int32_t> scalarInput{this, "FROM_DEV_SCALAR1", "", "Read to force an exception"};
+
+    std::promise<void> mainLoopStarted;
+
+    void mainLoop() override { mainLoopStarted.set_value(); }
+  } module{this, "TEST", "The test module"};
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testDestructiveWriteRecovery) {
+  std::cout << "testDestructiveWriteRecovery" << std::endl;
+
+  DestructiveWriteApplication app;
+  ctk::TestFacility test(false);
+  app.run();
+  auto started = app.module.mainLoopStarted.get_future();
+  BOOST_REQUIRE(started.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+
+  ctk::Device dummy;
+  dummy.open(deviceCDD);
+  auto dummyBackend =
+      boost::dynamic_pointer_cast<ctk::ExceptionDummy>(ctk::BackendFactory::getInstance().createBackend(deviceCDD));
+  auto statusPath = ctk::RegisterPath("/Devices") / deviceCDD / "status";
+  CHECK_EQUAL_TIMEOUT(test.readScalar<int32_t>(statusPath), 0, 10000);
+
+  // clear the register, put the device into the error state by a failing read and wait until it has recovered
+  auto forceRecovery = [&] {
+    dummy.write("/TEST/TO_DEV_ARRAY1", std::vector<int32_t>{0, 0, 0, 0});
+    dummyBackend->throwExceptionOpen = true;
+    dummyBackend->throwExceptionRead = true;
+    app.module.scalarInput.read();
+    CHECK_EQUAL_TIMEOUT(test.readScalar<int32_t>(statusPath), 1, 10000);
+    dummyBackend->throwExceptionRead = false;
+    dummyBackend->throwExceptionOpen = false;
+    CHECK_EQUAL_TIMEOUT(test.readScalar<int32_t>(statusPath), 0, 10000);
+  };
+
+  auto writeDestructively = [&](std::vector<int32_t> value) {
+    app.module.arrayOutput = value;
+    app.module.arrayOutput.writeDestructively();
+  };
+
+  // the data of a successful destructive write is retained and copied to the recoveryAccessor by the recovery
+  writeDestructively({1, 2, 3, 4});
+  BOOST_CHECK((dummy.read<int32_t>("/TEST/TO_DEV_ARRAY1", 0) == std::vector<int32_t>{1, 2, 3, 4}));
+  forceRecovery();
+  BOOST_CHECK((dummy.read<int32_t>("/TEST/TO_DEV_ARRAY1", 0) == std::vector<int32_t>{1, 2, 3, 4}));
+
+  // after the data has been materialised, the recoveryAccessor still holds it for the next recovery
+  forceRecovery();
+  BOOST_CHECK((dummy.read<int32_t>("/TEST/TO_DEV_ARRAY1", 0) == std::vector<int32_t>{1, 2, 3, 4}));
+
+  // a new destructive write after the materialisation replaces the recovery value
+  writeDestructively({5, 6, 7, 8});
+  BOOST_CHECK((dummy.read<int32_t>("/TEST/TO_DEV_ARRAY1", 0) == std::vector<int32_t>{5, 6, 7, 8}));
+  forceRecovery();
+  BOOST_CHECK((dummy.read<int32_t>("/TEST/TO_DEV_ARRAY1", 0) == std::vector<int32_t>{5, 6, 7, 8}));
+
+  // the data of a failing destructive write is retained as well and written by the recovery
+  dummyBackend->throwExceptionOpen = true;
+  dummyBackend->throwExceptionWrite = true;
+  writeDestructively({9, 10, 11, 12});
+  CHECK_EQUAL_TIMEOUT(test.readScalar<int32_t>(statusPath), 1, 10000);
+  dummyBackend->throwExceptionWrite = false;
+  dummyBackend->throwExceptionOpen = false;
+  CHECK_EQUAL_TIMEOUT(test.readScalar<int32_t>(statusPath), 0, 10000);
+  BOOST_CHECK((dummy.read<int32_t>("/TEST/TO_DEV_ARRAY1", 0) == std::vector<int32_t>{9, 10, 11, 12}));
 }
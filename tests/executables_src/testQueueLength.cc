@@ -0,0 +1,202 @@
+#define BOOST_TEST_MODULE testQueueLength
+
+#include <chrono>
+#include <future>
+#include <vector>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "ControlSystemModule.h"
+#include "ScalarAccessor.h"
+#include "TestFacility.h"
+#include "VariableNetwork.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+struct SenderModule : ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarOutput<int> out{this, "out", "", ""};
+
+  std::promise<void> mainLoopStarted;
+
+  // the output is written by the test after the initial value has been sent
+  void mainLoop() override {
+    out = 0;
+    out.write();
+    mainLoopStarted.set_value();
+  }
+};
+
+/*********************************************************************************************************************/
+
+struct ReceiverModule : ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<int> in{this, "in", "", ""};
+
+  std::promise<void> mainLoopStarted;
+
+  // the input is read by the test after the initial value has been received
+  void mainLoop() override { mainLoopStarted.set_value(); }
+};
+
+/*********************************************************************************************************************/
+
+/* Direct connection between two ApplicationModules */
+struct DirectApplication : ctk::Application {
+  DirectApplication() : Application("testSuite") {}
+  ~DirectApplication() { shutdown(); }
+
+  void defineConnections() { sender.out >> receiver.in; }
+
+  SenderModule sender{this, "Sender", ""};
+  ReceiverModule receiver{this, "Receiver", ""};
+};
+
+/*********************************************************************************************************************/
+
+/* Control system variable distributed to two ApplicationModules */
+struct FanOutApplication : ctk::Application {
+  FanOutApplication() : Application("testSuite") {}
+  ~FanOutApplication() { shutdown(); }
+
+  void defineConnections() { cs("var", typeid(int), 1) >> receiver1.in >> receiver2.in; }
+
+  ctk::ControlSystemModule cs;
+  ReceiverModule receiver1{this, "Receiver1", ""};
+  ReceiverModule receiver2{this, "Receiver2", ""};
+};
+
+/*********************************************************************************************************************/
+
+void waitForMainLoop(std::promise<void>& mainLoopStarted) {
+  auto started = mainLoopStarted.get_future();
+  BOOST_REQUIRE(started.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+}
+
+/* Read from the input until the last value of the burst has arrived and check that all values have been received in
+ * order. The latest value is never lost, so this terminates even if values in between have been lost. */
+void checkBurstReceived(ctk::ScalarPushInput<int>& input, const std::vector<int>& burst) {
+  std::vector<int> received;
+  while(received.empty() || received.back() != burst.back()) {
+    input.read();
+    received.push_back(input);
+  }
+  BOOST_CHECK(received == burst);
+  BOOST_CHECK(!input.readNonBlocking());
+}
+
+std::vector<int> makeBurst(size_t length) {
+  std::vector<int> burst;
+  for(size_t i = 0; i < length; ++i) burst.push_back(int(i) + 1);
+  return burst;
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testDefaultQueueLength) {
+  std::cout << "*** testDefaultQueueLength" << std::endl;
+
+  DirectApplication app;
+  BOOST_CHECK_EQUAL(app.getDefaultQueueLength(), 3);
+  app.setDefaultQueueLength(10);
+  BOOST_CHECK_EQUAL(app.getDefaultQueueLength(), 10);
+  app.initialise();
+
+  // no length has been requested for the variable, so the default applies
+  BOOST_CHECK_EQUAL(ctk::VariableNetworkNode(app.receiver.in).getOwner().getQueueLength(), 10);
+
+  app.run();
+  waitForMainLoop(app.sender.mainLoopStarted);
+  waitForMainLoop(app.receiver.mainLoopStarted);
+
+  // a burst longer than the built-in default is delivered without data loss
+  auto burst = makeBurst(10);
+  for(auto value : burst) {
+    app.sender.out = value;
+    BOOST_CHECK(!app.sender.out.write());
+  }
+  checkBurstReceived(app.receiver.in, burst);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testRequestedQueueLength) {
+  std::cout << "*** testRequestedQueueLength" << std::endl;
+
+  DirectApplication app;
+  app.receiver.in.setQueueLength(8);
+  app.initialise();
+
+  BOOST_CHECK_EQUAL(ctk::VariableNetworkNode(app.receiver.in).getOwner().getQueueLength(), 8);
+
+  app.run();
+  waitForMainLoop(app.sender.mainLoopStarted);
+  waitForMainLoop(app.receiver.mainLoopStarted);
+
+  auto burst = makeBurst(8);
+  for(auto value : burst) {
+    app.sender.out = value;
+    BOOST_CHECK(!app.sender.out.write());
+  }
+  checkBurstReceived(app.receiver.in, burst);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testMaximumOverConsumers) {
+  std::cout << "*** testMaximumOverConsumers" << std::endl;
+
+  FanOutApplication app;
+  app.receiver1.in.setQueueLength(4);
+  app.receiver2.in.setQueueLength(10);
+  ctk::TestFacility test(false);
+
+  // the longest queue requested by any node is used for the whole network
+  BOOST_CHECK_EQUAL(ctk::VariableNetworkNode(app.receiver1.in).getOwner().getQueueLength(), 10);
+
+  test.writeScalar("/var", 0);
+  app.run();
+  waitForMainLoop(app.receiver1.mainLoopStarted);
+  waitForMainLoop(app.receiver2.mainLoopStarted);
+
+  // both consumers receive the full burst, although only one of them has requested a queue of this length
+  auto burst = makeBurst(10);
+  for(auto value : burst) test.writeScalar("/var", value);
+  checkBurstReceived(app.receiver1.in, burst);
+  checkBurstReceived(app.receiver2.in, burst);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testRequestBelowDefault) {
+  std::cout << "*** testRequestBelowDefault" << std::endl;
+
+  // a request is a minimum, so it does not shrink the queue below the default
+  DirectApplication app;
+  app.setDefaultQueueLength(10);
+  app.receiver.in.setQueueLength(4);
+  app.initialise();
+  BOOST_CHECK_EQUAL(ctk::VariableNetworkNode(app.receiver.in).getOwner().getQueueLength(), 10);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testInvalidQueueLength) {
+  std::cout << "*** testInvalidQueueLength" << std::endl;
+
+  DirectApplication app;
+  BOOST_CHECK_THROW(app.setDefaultQueueLength(1), ctk::logic_error);
+  BOOST_CHECK_THROW(app.receiver.in.setQueueLength(1), ctk::logic_error);
+  app.receiver.in.setQueueLength(0); // no request
+  app.initialise();
+  BOOST_CHECK_THROW(app.setDefaultQueueLength(10), ctk::logic_error);
+}
+
+/*********************************************************************************************************************/
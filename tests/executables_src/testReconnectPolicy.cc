@@ -0,0 +1,249 @@
+#define BOOST_TEST_MODULE testReconnectPolicy
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <ChimeraTK/BackendFactory.h>
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+#include <ChimeraTK/ExceptionDummyBackend.h>
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "DeviceModule.h"
+#include "ScalarAccessor.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+struct TestModule : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPollInput<int> actuator{this, "actuator", "", "Read from device"};
+
+  std::promise<void> mainLoopStarted;
+
+  // the main loop is entered only after the initial value has been read from the device
+  void mainLoop() override { mainLoopStarted.set_value(); }
+};
+
+/*********************************************************************************************************************/
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") {}
+  ~TestApplication() { shutdown(); }
+
+  void defineConnections() { dev["MyModule"]("actuator") >> module.actuator; }
+
+  ctk::DeviceModule dev{this, "Dummy0"};
+  TestModule module{this, "TestModule", ""};
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testInitialDelay) {
+  std::cout << "*** testInitialDelay" << std::endl;
+
+  ctk::BackendFactory::getInstance().setDMapFilePath("test.dmap");
+
+  TestApplication app;
+  ctk::ReconnectPolicy policy;
+  policy.initialDelay = std::chrono::milliseconds(200);
+  app.dev.setReconnectPolicy(policy);
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  auto t0 = std::chrono::steady_clock::now();
+  app.run();
+
+  auto started = app.module.mainLoopStarted.get_future();
+  BOOST_REQUIRE(started.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+  auto t1 = std::chrono::steady_clock::now();
+  BOOST_CHECK(t1 - t0 >= std::chrono::milliseconds(200));
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testInvalidPolicy) {
+  std::cout << "*** testInvalidPolicy" << std::endl;
+
+  TestApplication app;
+
+  ctk::ReconnectPolicy policy;
+  policy.backoffFactor = 2.;
+  policy.maxDelay = std::chrono::seconds(10);
+  policy.jitter = 0.2;
+  app.setDefaultReconnectPolicy(policy);
+  app.dev.setReconnectPolicy(policy);
+
+  auto invalid = policy;
+  invalid.backoffFactor = 0.5;
+  BOOST_CHECK_THROW(app.setDefaultReconnectPolicy(invalid), ctk::logic_error);
+
+  invalid = policy;
+  invalid.maxDelay = std::chrono::milliseconds(100);
+  BOOST_CHECK_THROW(app.dev.setReconnectPolicy(invalid), ctk::logic_error);
+
+  invalid = policy;
+  invalid.jitter = 1.;
+  BOOST_CHECK_THROW(app.setDefaultReconnectPolicy(invalid), ctk::logic_error);
+
+  invalid = policy;
+  invalid.retryDelay = std::chrono::milliseconds(0);
+  BOOST_CHECK_THROW(app.dev.setReconnectPolicy(invalid), ctk::logic_error);
+}
+
+/*********************************************************************************************************************/
+
+constexpr char failingDummySdm[] = "sdm://./OpenRecordingDummy=test5.map";
+
+/* ExceptionDummy recording the time of each attempt to open it */
+class OpenRecordingDummy : public ctk::ExceptionDummy {
+ public:
+  OpenRecordingDummy(std::string mapFileName) : ExceptionDummy(mapFileName) {}
+
+  static boost::shared_ptr<DeviceBackend> createInstance(
+      std::string, std::string, std::list<std::string> parameters, std::string) {
+    return boost::shared_ptr<DeviceBackend>(new OpenRecordingDummy(parameters.front()));
+  }
+
+  void open() override {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      openAttempts.push_back(std::chrono::steady_clock::now());
+    }
+    ExceptionDummy::open();
+  }
+
+  std::vector<std::chrono::steady_clock::time_point> getOpenAttempts() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return openAttempts;
+  }
+
+ private:
+  std::mutex mutex;
+  std::vector<std::chrono::steady_clock::time_point> openAttempts;
+};
+
+/*********************************************************************************************************************/
+
+struct FailingDeviceApplication : public ctk::Application {
+  FailingDeviceApplication() : Application("testSuite") {
+    ctk::BackendFactory::getInstance().registerBackendType(
+        "OpenRecordingDummy", "", &OpenRecordingDummy::createInstance, CHIMERATK_DEVICEACCESS_VERSION);
+  }
+  ~FailingDeviceApplication() { shutdown(); }
+
+  void defineConnections() { dev["TEST"]("FROM_DEV_SCALAR1") >> module.actuator; }
+
+  ctk::DeviceModule dev{this, failingDummySdm};
+  TestModule module{this, "TestModule", ""};
+
+  /* Run the application with a device failing to open until nAttempts have been made. Returns the time of the call
+   * to run() followed by the times of all attempts. */
+  std::vector<std::chrono::steady_clock::time_point> recordAttempts(size_t nAttempts) {
+    auto backend = boost::dynamic_pointer_cast<OpenRecordingDummy>(
+        ctk::BackendFactory::getInstance().createBackend(failingDummySdm));
+    BOOST_REQUIRE(backend);
+    backend->throwExceptionOpen = true;
+
+    auto pvManagers = ctk::createPVManager();
+    setPVManager(pvManagers.second);
+    initialise();
+    std::vector<std::chrono::steady_clock::time_point> times{std::chrono::steady_clock::now()};
+    run();
+
+    auto t0 = std::chrono::steady_clock::now();
+    while(backend->getOpenAttempts().size() < nAttempts) {
+      BOOST_REQUIRE(std::chrono::steady_clock::now() - t0 < std::chrono::seconds(30));
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    backend->throwExceptionOpen = false;
+    auto started = module.mainLoopStarted.get_future();
+    BOOST_REQUIRE(started.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+
+    auto attempts = backend->getOpenAttempts();
+    times.insert(times.end(), attempts.begin(), attempts.begin() + nAttempts);
+    return times;
+  }
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testImmediateOpen) {
+  std::cout << "*** testImmediateOpen" << std::endl;
+
+  FailingDeviceApplication app;
+  ctk::ReconnectPolicy policy;
+  policy.retryDelay = std::chrono::milliseconds(500);
+  app.dev.setReconnectPolicy(policy);
+  auto times = app.recordAttempts(2);
+
+  // The first attempt to open the device is made without delay (previously it was delayed by 500 ms), so it comes
+  // much earlier than the retry. The times of the attempts are recorded by the backend, so the time needed to read the
+  // initial values etc. does not matter here.
+  BOOST_CHECK(times[2] - times[1] >= std::chrono::milliseconds(500));
+  BOOST_CHECK(2 * (times[1] - times[0]) < times[2] - times[1]);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testBackoff) {
+  std::cout << "*** testBackoff" << std::endl;
+
+  FailingDeviceApplication app;
+  ctk::ReconnectPolicy policy;
+  policy.initialDelay = std::chrono::milliseconds(100);
+  policy.retryDelay = std::chrono::milliseconds(20);
+  policy.backoffFactor = 10.;
+  policy.maxDelay = std::chrono::milliseconds(500);
+  app.dev.setReconnectPolicy(policy);
+
+  auto times = app.recordAttempts(5);
+  auto gap = [&](size_t i) { return times[i + 1] - times[i]; };
+
+  // Expected delays: 100 ms (initialDelay), 20 ms (retryDelay), 200 ms, then capped to 500 ms (instead of 2000 ms and
+  // 20000 ms). Delays are never shorter than requested.
+  BOOST_CHECK(gap(0) >= std::chrono::milliseconds(100));
+  BOOST_CHECK(gap(1) >= std::chrono::milliseconds(20));
+  BOOST_CHECK(gap(2) >= std::chrono::milliseconds(200));
+  BOOST_CHECK(gap(3) >= std::chrono::milliseconds(500));
+  BOOST_CHECK(gap(4) >= std::chrono::milliseconds(500));
+
+  // The delays can be longer on a loaded machine, so the sequence is checked by ratios with a wide margin. The
+  // retries are not derived from the initialDelay (the second gap would be 5 times the first instead of 1/5), and the
+  // delays are capped (the ratios would be 10 instead of 2.5 and 1).
+  BOOST_CHECK(gap(1) < 2 * gap(0));
+  BOOST_CHECK(gap(3) < 5 * gap(2));
+  BOOST_CHECK(gap(4) < 5 * gap(3));
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testJitter) {
+  std::cout << "*** testJitter" << std::endl;
+
+  FailingDeviceApplication app;
+  ctk::ReconnectPolicy policy;
+  policy.retryDelay = std::chrono::milliseconds(100);
+  policy.maxDelay = std::chrono::milliseconds(100);
+  policy.jitter = 0.5;
+  app.dev.setReconnectPolicy(policy);
+
+  auto times = app.recordAttempts(7);
+
+  // the retries are spaced by 100 ms +- 50 ms. The delays are never shorter than the lower limit and are not all
+  // the same.
+  std::vector<std::chrono::steady_clock::duration> gaps;
+  for(size_t i = 2; i < times.size(); ++i) gaps.push_back(times[i] - times[i - 1]);
+  for(auto& gap : gaps) BOOST_CHECK(gap >= std::chrono::milliseconds(50));
+  auto minmax = std::minmax_element(gaps.begin(), gaps.end());
+  BOOST_CHECK(*minmax.second - *minmax.first > std::chrono::milliseconds(5));
+}
@@ -0,0 +1,114 @@
+#define BOOST_TEST_MODULE testSpscTransport
+
+#include <thread>
+#include <unistd.h>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "SpscAccessor.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+using Pair = std::pair<boost::shared_ptr<ctk::NDRegisterAccessor<int32_t>>,
+    boost::shared_ptr<ctk::NDRegisterAccessor<int32_t>>>;
+
+/*********************************************************************************************************************/
+
+Pair createSpscPair(size_t nElements, size_t length) {
+  return ctk::createSpscVariable<int32_t>(nElements, "var", "", "", length);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testSemantics) {
+  std::cout << "*** testSemantics" << std::endl;
+
+  auto pair = createSpscPair(4, 3);
+  auto& sender = pair.first;
+  auto& receiver = pair.second;
+
+  BOOST_CHECK(receiver->readNonBlocking() == false);
+
+  // values are received in order with version number and validity
+  ctk::VersionNumber v1, v2;
+  sender->accessChannel(0) = {1, 2, 3, 4};
+  BOOST_CHECK(sender->write(v1) == false);
+  sender->accessChannel(0) = {5, 6, 7, 8};
+  sender->setDataValidity(ctk::DataValidity::faulty);
+  BOOST_CHECK(sender->write(v2) == false);
+  receiver->read();
+  BOOST_CHECK(receiver->accessChannel(0) == std::vector<int32_t>({1, 2, 3, 4}));
+  BOOST_CHECK(receiver->getVersionNumber() == v1);
+  BOOST_CHECK(receiver->dataValidity() == ctk::DataValidity::ok);
+  receiver->read();
+  BOOST_CHECK(receiver->accessChannel(0) == std::vector<int32_t>({5, 6, 7, 8}));
+  BOOST_CHECK(receiver->getVersionNumber() == v2);
+  BOOST_CHECK(receiver->dataValidity() == ctk::DataValidity::faulty);
+  BOOST_CHECK(receiver->readNonBlocking() == false);
+
+  // non-destructive write keeps the user buffer
+  BOOST_CHECK(sender->accessChannel(0) == std::vector<int32_t>({5, 6, 7, 8}));
+
+  // overflowing queue: the last value is overwritten and data loss is reported, the latest value is always received
+  sender->setDataValidity(ctk::DataValidity::ok);
+  for(int32_t i = 0; i < 3; ++i) {
+    sender->accessData(0) = i;
+    BOOST_CHECK(sender->write() == false);
+  }
+  sender->accessData(0) = 42;
+  BOOST_CHECK(sender->write() == true);
+  for(int32_t expected : {0, 1, 42}) {
+    BOOST_CHECK(receiver->readNonBlocking() == true);
+    BOOST_CHECK_EQUAL(receiver->accessData(0), expected);
+  }
+  BOOST_CHECK(receiver->readNonBlocking() == false);
+
+  // after the overflow the queue is usable again in order
+  for(int32_t i = 10; i < 13; ++i) {
+    sender->accessData(0) = i;
+    BOOST_CHECK(sender->write() == false);
+  }
+  for(int32_t expected : {10, 11, 12}) {
+    receiver->read();
+    BOOST_CHECK_EQUAL(receiver->accessData(0), expected);
+  }
+
+  // interrupt
+  std::thread t([&] { BOOST_CHECK_THROW(receiver->read(), boost::thread_interrupted); });
+  usleep(10000);
+  receiver->interrupt();
+  t.join();
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testScalarSemantics) {
+  std::cout << "*** testScalarSemantics" << std::endl;
+
+  // scalars are stored inline in the slots, check with a non-trivial type
+  auto pair = ctk::createSpscVariable<std::string>(1, "var", "", "", 3);
+  auto& sender = pair.first;
+  auto& receiver = pair.second;
+
+  ctk::VersionNumber v1;
+  sender->accessData(0) = "first";
+  sender->setDataValidity(ctk::DataValidity::faulty);
+  BOOST_CHECK(sender->write(v1) == false);
+  BOOST_CHECK_EQUAL(sender->accessData(0), "first");
+
+  sender->accessData(0) = "second";
+  sender->setDataValidity(ctk::DataValidity::ok);
+  BOOST_CHECK(sender->writeDestructively() == false);
+
+  receiver->read();
+  BOOST_CHECK_EQUAL(receiver->accessData(0), "first");
+  BOOST_CHECK(receiver->getVersionNumber() == v1);
+  BOOST_CHECK(receiver->dataValidity() == ctk::DataValidity::faulty);
+  receiver->read();
+  BOOST_CHECK_EQUAL(receiver->accessData(0), "second");
+  BOOST_CHECK(receiver->dataValidity() == ctk::DataValidity::ok);
+  BOOST_CHECK_EQUAL(receiver->getNumberOfSamples(), 1);
+}
+
+/*********************************************************************************************************************/
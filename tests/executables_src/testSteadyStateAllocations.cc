@@ -0,0 +1,249 @@
+#define BOOST_TEST_MODULE testSteadyStateAllocations
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <boost/test/included/unit_test.hpp>
+#include <boost/thread/barrier.hpp>
+
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+#include <ChimeraTK/Device.h>
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "ArrayAccessor.h"
+#include "ConflatingAccessor.h"
+#include "DeviceModule.h"
+#include "ScalarAccessor.h"
+#include "SpscAccessor.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+/* Allocation counting hook. Allocations are only counted while countAllocations is set, and nothing else (like
+ * Boost.Test checks) must be executed in that time. */
+
+static std::atomic<bool> countAllocations{false};
+static std::atomic<size_t> nAllocations{0};
+
+void* operator new(size_t size) {
+  if(countAllocations) ++nAllocations;
+  void* p = std::malloc(size ? size : 1);
+  if(!p) throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+  std::free(p);
+}
+
+struct AllocationCounter {
+  AllocationCounter() {
+    nAllocations = 0;
+    countAllocations = true;
+  }
+  ~AllocationCounter() { countAllocations = false; }
+  size_t get() {
+    countAllocations = false;
+    return nAllocations;
+  }
+};
+
+/*********************************************************************************************************************/
+
+constexpr size_t nElements{1000};
+constexpr size_t nTransfers{1000};
+
+/*********************************************************************************************************************/
+
+template<typename PAIR>
+void checkTransport(PAIR pair) {
+  auto& sender = pair.first;
+  auto& receiver = pair.second;
+
+  // warm up
+  sender->write();
+  receiver->read();
+
+  AllocationCounter counter;
+  for(size_t i = 0; i < nTransfers; ++i) {
+    sender->accessData(0) = int32_t(i);
+    sender->write();
+    sender->writeDestructively();
+    receiver->readLatest();
+  }
+  auto n = counter.get();
+  BOOST_CHECK_EQUAL(n, 0);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testTransports) {
+  std::cout << "*** testTransports" << std::endl;
+
+  checkTransport(ctk::createSpscVariable<int32_t>(nElements, "var", "", "", 3));
+  checkTransport(ctk::createConflatingVariable<int32_t>(nElements, "var", "", ""));
+}
+
+/*********************************************************************************************************************/
+/* Module sending the input array back to the test through its output */
+
+struct Relay : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ArrayPushInput<int32_t> in{this, "in", "", nElements, "Input"};
+  ctk::ArrayOutput<int32_t> out{this, "out", "", nElements, "Output"};
+
+  void mainLoop() override {
+    while(true) {
+      for(size_t i = 0; i < nElements; ++i) out[i] = in[i];
+      out.write();
+      in.read();
+    }
+  }
+};
+
+/*********************************************************************************************************************/
+/* Module driven by the test thread */
+
+struct Driver : public ctk::ApplicationModule {
+  Driver(EntityOwner* owner, const std::string& name) : ApplicationModule(owner, name, ""), mainLoopStarted(2) {}
+
+  ctk::ArrayOutput<int32_t> out{this, "out", "", nElements, "Output"};
+  ctk::ArrayPushInput<int32_t> returnA{this, "returnA", "", nElements, "Return from relayA"};
+  ctk::ArrayPushInput<int32_t> returnB{this, "returnB", "", nElements, "Return from relayB"};
+
+  boost::barrier mainLoopStarted;
+
+  void mainLoop() override { mainLoopStarted.wait(); }
+};
+
+/*********************************************************************************************************************/
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") {}
+  ~TestApplication() { shutdown(); }
+
+  void defineConnections() {
+    // the driver output has two consumers (FeedingFanOut), the relay outputs are direct connections
+    driver.out >> relayA.in >> relayB.in;
+    relayA.out >> driver.returnA;
+    relayB.out >> driver.returnB;
+  }
+
+  Driver driver{this, "Driver"};
+  Relay relayA{this, "RelayA", ""};
+  Relay relayB{this, "RelayB", ""};
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testApplication) {
+  std::cout << "*** testApplication" << std::endl;
+
+  TestApplication app;
+  app.initialise();
+  app.run();
+
+  // initial value, received by the Driver before entering its main loop
+  app.driver.out.write();
+  app.driver.mainLoopStarted.wait();
+
+  auto transfer = [&](size_t i) {
+    for(size_t k = 0; k < nElements; ++k) app.driver.out[k] = int32_t(i + k);
+    app.driver.out.write();
+    app.driver.returnA.read();
+    app.driver.returnB.read();
+  };
+
+  // warm up
+  for(size_t i = 0; i < 10; ++i) transfer(i);
+
+  AllocationCounter counter;
+  for(size_t i = 0; i < nTransfers; ++i) transfer(i);
+  auto n = counter.get();
+  BOOST_CHECK_EQUAL(n, 0);
+
+  BOOST_CHECK_EQUAL(app.driver.returnA[nElements - 1], int32_t(nTransfers - 1 + nElements - 1));
+  BOOST_CHECK_EQUAL(app.driver.returnB[0], int32_t(nTransfers - 1));
+  BOOST_CHECK_EQUAL(ctk::Application::getAndResetDataLossCounter(), 0);
+}
+
+/*********************************************************************************************************************/
+/* Module triggering the read of two device registers through a TriggerFanOut */
+
+constexpr char deviceCDD[] = "(dummy?map=test.map)";
+
+struct TriggeringDriver : public ctk::ApplicationModule {
+  TriggeringDriver(EntityOwner* owner, const std::string& name)
+  : ApplicationModule(owner, name, ""), mainLoopStarted(2) {}
+
+  ctk::ScalarOutput<int32_t> trigger{this, "trigger", "", "Trigger"};
+  ctk::ScalarPushInput<int32_t> scalar{this, "REG1", "", "Scalar read from the device"};
+  ctk::ArrayPushInput<int32_t> array{this, "AREA1", "", 4, "Array read from the device"};
+
+  boost::barrier mainLoopStarted;
+
+  void mainLoop() override { mainLoopStarted.wait(); }
+};
+
+/*********************************************************************************************************************/
+
+struct TriggeredDeviceApplication : public ctk::Application {
+  TriggeredDeviceApplication() : Application("testSuite") {}
+  ~TriggeredDeviceApplication() { shutdown(); }
+
+  void defineConnections() {
+    // both registers are read by the same TriggerFanOut
+    dev("REG1", typeid(int32_t), 1)[driver.trigger] >> driver.scalar;
+    dev("AREA1", typeid(int32_t), 4)[driver.trigger] >> driver.array;
+  }
+
+  ctk::DeviceModule dev{this, deviceCDD};
+  TriggeringDriver driver{this, "Driver"};
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testTriggeredDeviceRead) {
+  std::cout << "*** testTriggeredDeviceRead" << std::endl;
+
+  ctk::Device device;
+  device.open(deviceCDD);
+  device.write<int32_t>("REG1", 42);
+  device.write<int32_t>("AREA1", std::vector<int32_t>{1, 2, 3, 4});
+
+  TriggeredDeviceApplication app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  app.run();
+
+  // initial value, received by the driver before entering its main loop
+  app.driver.trigger.write();
+  app.driver.mainLoopStarted.wait();
+
+  auto transfer = [&] {
+    app.driver.trigger.write();
+    app.driver.scalar.read();
+    app.driver.array.read();
+  };
+
+  // warm up, also lets the DeviceModule finish publishing its status after the device has been opened
+  for(size_t i = 0; i < 100; ++i) transfer();
+
+  AllocationCounter counter;
+  for(size_t i = 0; i < nTransfers; ++i) transfer();
+  auto n = counter.get();
+  BOOST_CHECK_EQUAL(n, 0);
+
+  BOOST_CHECK_EQUAL(int32_t(app.driver.scalar), 42);
+  for(size_t i = 0; i < 4; ++i) BOOST_CHECK_EQUAL(app.driver.array[i], int32_t(i + 1));
+  BOOST_CHECK_EQUAL(ctk::Application::getAndResetDataLossCounter(), 0);
+}
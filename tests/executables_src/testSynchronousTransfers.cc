@@ -0,0 +1,238 @@
+#define BOOST_TEST_MODULE testSynchronousTransfers
+
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <future>
+#include <thread>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <ChimeraTK/BackendFactory.h>
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+#include <ChimeraTK/ExceptionDummyBackend.h>
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "DeviceModule.h"
+#include "ScalarAccessor.h"
+
+#include "check_timeout.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+constexpr char countingDummySdm[] = "sdm://./CountingExceptionDummy=test5.map";
+
+/*********************************************************************************************************************/
+
+/* ExceptionDummy counting the transfers in progress. Since the application must not access the device while it is
+ * opened by the recovery, open() records whether any transfer is in progress at that point. */
+class CountingExceptionDummy : public ctk::ExceptionDummy {
+ public:
+  CountingExceptionDummy(std::string mapFileName) : ExceptionDummy(mapFileName) {}
+
+  static boost::shared_ptr<DeviceBackend> createInstance(
+      std::string, std::string, std::list<std::string> parameters, std::string) {
+    return boost::shared_ptr<DeviceBackend>(new CountingExceptionDummy(parameters.front()));
+  }
+
+  void open() override {
+    if(transfersInProgress > 0) ++openedDuringTransfer;
+    ++nOpen;
+    ExceptionDummy::open();
+  }
+
+  void read(uint64_t bar, uint64_t address, int32_t* data, size_t sizeInBytes) override {
+    Transfer t(*this);
+    ExceptionDummy::read(bar, address, data, sizeInBytes);
+  }
+
+  void write(uint64_t bar, uint64_t address, int32_t const* data, size_t sizeInBytes) override {
+    Transfer t(*this);
+    ExceptionDummy::write(bar, address, data, sizeInBytes);
+  }
+
+  std::atomic<size_t> transfersInProgress{0};
+  std::atomic<size_t> openedDuringTransfer{0};
+  std::atomic<size_t> nOpen{0};
+  std::atomic<size_t> nExceptions{0};
+
+ private:
+  /* Counts the transfer while it is in progress. The transfer is slowed down, so transfers overlap with the
+   * exception reporting of other threads. */
+  struct Transfer {
+    Transfer(CountingExceptionDummy& backend) : _backend(backend) {
+      ++_backend.transfersInProgress;
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    ~Transfer() {
+      if(std::uncaught_exceptions() > 0) ++_backend.nExceptions;
+      --_backend.transfersInProgress;
+    }
+    CountingExceptionDummy& _backend;
+  };
+};
+
+/*********************************************************************************************************************/
+
+/* DeviceModule giving the test access to the transfer bookkeeping */
+struct TestDeviceModule : ctk::DeviceModule {
+  using ctk::DeviceModule::DeviceModule;
+  using ctk::DeviceModule::beginSynchronousTransfer;
+  using ctk::DeviceModule::deviceState;
+  using ctk::DeviceModule::endSynchronousTransfer;
+};
+
+/*********************************************************************************************************************/
+
+struct TestModule : ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPollInput<int32_t> in1{this, "in1", "", ""};
+  ctk::ScalarPollInput<int32_t> in2{this, "in2", "", ""};
+  ctk::ScalarOutput<int32_t> out1{this, "out1", "", ""};
+  ctk::ScalarOutput<int32_t> out2{this, "out2", "", ""};
+
+  std::promise<void> mainLoopStarted;
+
+  // the accessors are used by the test threads, once the initial values have been exchanged
+  void mainLoop() override { mainLoopStarted.set_value(); }
+};
+
+/*********************************************************************************************************************/
+
+struct TestApplication : ctk::Application {
+  TestApplication() : Application("testSuite") {
+    ctk::BackendFactory::getInstance().setDMapFilePath("test.dmap");
+    ctk::BackendFactory::getInstance().registerBackendType(
+        "CountingExceptionDummy", "", &CountingExceptionDummy::createInstance, CHIMERATK_DEVICEACCESS_VERSION);
+  }
+  ~TestApplication() { shutdown(); }
+
+  void defineConnections() {
+    dev["TEST"]("FROM_DEV_SCALAR1") >> module.in1;
+    dev["TEST"]("FROM_DEV_SCALAR2") >> module.in2;
+    module.out1 >> dev["TEST"]("TO_DEV_SCALAR1");
+    module.out2 >> dev["TEST"]("TO_DEV_SCALAR2");
+  }
+
+  TestDeviceModule dev{this, countingDummySdm};
+  TestModule module{this, "TestModule", ""};
+
+  /* Start the application and return the backend */
+  boost::shared_ptr<CountingExceptionDummy> start() {
+    auto pvManagers = ctk::createPVManager();
+    setPVManager(pvManagers.second);
+    initialise();
+    run();
+    auto started = module.mainLoopStarted.get_future();
+    BOOST_REQUIRE(started.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+    auto backend = boost::dynamic_pointer_cast<CountingExceptionDummy>(
+        ctk::BackendFactory::getInstance().createBackend(countingDummySdm));
+    BOOST_REQUIRE(backend);
+    return backend;
+  }
+
+  /* Read a register directly from the backend */
+  int32_t readRegister(CountingExceptionDummy& backend, const std::string& name) {
+    auto reg = backend.getRawAccessor("TEST", name);
+    auto lock = reg.getBufferLock();
+    return int32_t(reg);
+  }
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testConcurrentTransfersWithExceptions) {
+  std::cout << "*** testConcurrentTransfersWithExceptions" << std::endl;
+
+  TestApplication app;
+  auto backend = app.start();
+
+  // each accessor is used exclusively by one thread
+  std::atomic<bool> stop{false};
+  std::atomic<size_t> nReads{0};
+  auto reader = [&](ctk::ScalarPollInput<int32_t>& input) {
+    while(!stop) {
+      input.read();
+      ++nReads;
+    }
+  };
+  int32_t lastWritten1{0}, lastWritten2{0};
+  auto writer = [&](ctk::ScalarOutput<int32_t>& output, int32_t& lastWritten) {
+    while(!stop) {
+      output = ++lastWritten;
+      output.write();
+    }
+  };
+  std::thread reader1(reader, std::ref(app.module.in1));
+  std::thread reader2(reader, std::ref(app.module.in2));
+  std::thread writer1(writer, std::ref(app.module.out1), std::ref(lastWritten1));
+  std::thread writer2(writer, std::ref(app.module.out2), std::ref(lastWritten2));
+
+  // alternately inject read and write errors and wait until the recovery has reopened the device
+  for(size_t i = 0; i < 20; ++i) {
+    auto& throwException = (i % 2 == 0) ? backend->throwExceptionRead : backend->throwExceptionWrite;
+    size_t nExceptions = backend->nExceptions;
+    size_t nOpen = backend->nOpen;
+    throwException = true;
+    CHECK_TIMEOUT(backend->nExceptions > nExceptions, 10000);
+    throwException = false;
+    CHECK_TIMEOUT(backend->nOpen > nOpen, 10000);
+  }
+
+  stop = true;
+  reader1.join();
+  reader2.join();
+  writer1.join();
+  writer2.join();
+
+  // the recovery never opened the device while a transfer was in progress
+  BOOST_CHECK_EQUAL(backend->openedDuringTransfer.load(), 0);
+  BOOST_CHECK(nReads > 0);
+
+  // after the final recovery, the device has no error and no transfer is counted, so no transfer was lost or counted
+  // twice
+  CHECK_TIMEOUT(app.dev.deviceState == 0, 10000);
+  BOOST_CHECK_EQUAL(app.dev.deviceState.load(), 0);
+
+  // no write was lost: either it was successful or the recovery has written the value
+  BOOST_CHECK_EQUAL(app.readRegister(*backend, "TO_DEV_SCALAR1"), lastWritten1);
+  BOOST_CHECK_EQUAL(app.readRegister(*backend, "TO_DEV_SCALAR2"), lastWritten2);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testRecoveryWaitsForTransfers) {
+  std::cout << "*** testRecoveryWaitsForTransfers" << std::endl;
+
+  TestApplication app;
+  auto backend = app.start();
+
+  app.module.out1 = 1;
+  app.module.out1.write();
+  BOOST_CHECK_EQUAL(app.readRegister(*backend, "TO_DEV_SCALAR1"), 1);
+
+  // hold a transfer open, as if another thread was just reading from the device
+  BOOST_REQUIRE(app.dev.beginSynchronousTransfer());
+
+  // a failing write puts the device into the error state
+  size_t nOpen = backend->nOpen;
+  backend->throwExceptionWrite = true;
+  app.module.out1 = 2;
+  app.module.out1.write();
+  backend->throwExceptionWrite = false;
+  CHECK_TIMEOUT((app.dev.deviceState & 1) == 1, 10000);
+
+  // the recovery must not start while the transfer is in progress
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  BOOST_CHECK_EQUAL(backend->nOpen.load(), nOpen);
+  BOOST_CHECK_EQUAL(app.readRegister(*backend, "TO_DEV_SCALAR1"), 1);
+
+  // finishing the transfer wakes up the recovery, which writes the value again
+  app.dev.endSynchronousTransfer();
+  CHECK_TIMEOUT(app.dev.deviceState == 0, 10000);
+  BOOST_CHECK(backend->nOpen > nOpen);
+  BOOST_CHECK_EQUAL(app.readRegister(*backend, "TO_DEV_SCALAR1"), 2);
+}
@@ -0,0 +1,146 @@
+#define BOOST_TEST_MODULE testThreadedFanOut
+
+#include <vector>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <ChimeraTK/ControlSystemAdapter/ProcessArray.h>
+
+#include "ThreadedFanOut.h"
+#include "VariableNetwork.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+/* Slave recording all values written to it. A slave with zero elements acts like a trigger. After a destructive
+ * write, the user buffer is replaced by a buffer of sizeAfterDestructiveWrite elements filled with -1, since its
+ * content is undefined after a destructive write (e.g. it could be a buffer of the slave's internal queue). */
+class RecordingSlave : public ctk::NDRegisterAccessor<int32_t> {
+ public:
+  RecordingSlave(size_t nElements, size_t sizeAfterDestructiveWrite)
+  : ctk::NDRegisterAccessor<int32_t>("slave", {}), _sizeAfterDestructiveWrite(sizeAfterDestructiveWrite) {
+    buffer_2D.resize(1);
+    buffer_2D[0].resize(nElements, -1);
+  }
+
+  void doReadTransferSynchronously() override {}
+
+  bool doWriteTransfer(ctk::VersionNumber versionNumber) override {
+    received.push_back(buffer_2D[0]);
+    versions.push_back(versionNumber);
+    return false;
+  }
+
+  bool doWriteTransferDestructively(ctk::VersionNumber versionNumber) override {
+    doWriteTransfer(versionNumber);
+    buffer_2D[0] = std::vector<int32_t>(_sizeAfterDestructiveWrite, -1);
+    return false;
+  }
+
+  bool mayReplaceOther(const boost::shared_ptr<ctk::TransferElement const>&) const override { return false; }
+
+  bool isReadOnly() const override { return false; }
+
+  bool isReadable() const override { return false; }
+
+  bool isWriteable() const override { return true; }
+
+  std::vector<boost::shared_ptr<ctk::TransferElement>> getHardwareAccessingElements() override { return {}; }
+
+  void replaceTransferElement(boost::shared_ptr<ctk::TransferElement>) override {}
+
+  std::list<boost::shared_ptr<ctk::TransferElement>> getInternalElements() override { return {}; }
+
+  std::vector<std::vector<int32_t>> received;
+  std::vector<ctk::VersionNumber> versions;
+
+ private:
+  size_t _sizeAfterDestructiveWrite;
+};
+
+/*********************************************************************************************************************/
+
+/* Send the given number of updates through a ThreadedFanOut without starting its thread. The feeder is read and
+ * distribute() is called for each update, as done by the thread and the fan-out dispatcher. Each slave must receive
+ * all updates. For the first nSwaps updates the feeder's buffer is expected to be swapped into the last data slave,
+ * for the remaining updates it is expected to be copied. */
+void checkDistribution(
+    std::vector<boost::shared_ptr<RecordingSlave>> slaves, size_t nElements, size_t nUpdates, size_t nSwaps) {
+  auto feeder = ctk::createSynchronizedProcessArray<int32_t>(
+      nElements, "feeder", "", "", {}, 3, {ctk::AccessMode::wait_for_new_data});
+
+  ctk::VariableNetwork network;
+  ctk::ConsumerImplementationPairs<int32_t> consumers;
+  for(auto& slave : slaves) consumers.emplace_back(slave, ctk::VariableNetworkNode());
+  ctk::ThreadedFanOut<int32_t> fanOut(feeder.second, network, consumers);
+
+  std::vector<std::vector<int32_t>> sent;
+  std::vector<ctk::VersionNumber> versions;
+  for(size_t update = 0; update < nUpdates; ++update) {
+    std::vector<int32_t> value;
+    for(size_t i = 0; i < nElements; ++i) value.push_back(int32_t(100 * update + i));
+    feeder.first->accessChannel(0) = value;
+    feeder.first->write();
+    sent.push_back(value);
+
+    // the feeder receives into its buffer, even if it has been swapped into a slave by the previous distribute()
+    BOOST_REQUIRE(feeder.second->readNonBlocking());
+    BOOST_CHECK(feeder.second->accessChannel(0) == value);
+    versions.push_back(feeder.second->getVersionNumber());
+    fanOut.distribute(versions.back());
+
+    // after a swap, the feeder holds the previous buffer of the slave, otherwise it still holds the value
+    BOOST_CHECK_EQUAL(feeder.second->accessChannel(0).size(), nElements);
+    if(update < nSwaps) {
+      BOOST_CHECK(feeder.second->accessChannel(0) == std::vector<int32_t>(nElements, -1));
+    }
+    else {
+      BOOST_CHECK(feeder.second->accessChannel(0) == value);
+    }
+  }
+
+  for(auto& slave : slaves) {
+    BOOST_CHECK(slave->versions == versions);
+    if(slave->getNumberOfSamples() == 0) {
+      // trigger slaves receive no data
+      for(auto& value : slave->received) BOOST_CHECK(value.empty());
+    }
+    else {
+      BOOST_CHECK(slave->received == sent);
+    }
+  }
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testSwapToLastDataSlave) {
+  std::cout << "*** testSwapToLastDataSlave" << std::endl;
+
+  // The last slave is a trigger, so the buffer is swapped into the second slave. The slaves leave buffers of the
+  // right size after the destructive write, so the swap is used for each update.
+  checkDistribution({boost::make_shared<RecordingSlave>(10, 10), boost::make_shared<RecordingSlave>(10, 10),
+                        boost::make_shared<RecordingSlave>(0, 0)},
+      10, 5, 5);
+
+  // same for scalars
+  checkDistribution({boost::make_shared<RecordingSlave>(1, 1), boost::make_shared<RecordingSlave>(1, 1),
+                        boost::make_shared<RecordingSlave>(0, 0)},
+      1, 5, 5);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testCopyFallback) {
+  std::cout << "*** testCopyFallback" << std::endl;
+
+  // The last data slave leaves a buffer of a different size after the destructive write. Swapping it into the feeder
+  // would break the feeder, so the data must be copied instead for all but the first update. The trigger is placed
+  // between the data slaves.
+  checkDistribution({boost::make_shared<RecordingSlave>(10, 10), boost::make_shared<RecordingSlave>(0, 0),
+                        boost::make_shared<RecordingSlave>(10, 5)},
+      10, 5, 1);
+}
+
+/*********************************************************************************************************************/
@@ -6,7 +6,9 @@
  */
 
 #include <chrono>
+#include <condition_variable>
 #include <future>
+#include <mutex>
 
 #define BOOST_TEST_MODULE testTrigger
 
@@ -35,12 +37,38 @@ using namespace boost::unit_test_framework;
 namespace ctk = ChimeraTK;
 
 constexpr char dummySdm[] = "sdm://./TestTransferGroupDummy=test.map";
+constexpr char dummySdm2[] = "sdm://./TestTransferGroupDummy=test4.map";
 
 // list of user types the accessors are tested with
 typedef boost::mpl::list<int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t, float, double> test_types;
 
 /**********************************************************************************************************************/
 
+/* Meeting point for concurrent reads: wait() returns when the expected number of threads has called it, or after a
+ * timeout. */
+struct Rendezvous {
+  explicit Rendezvous(size_t nExpected) : _nExpected(nExpected) {}
+
+  void wait() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    ++_nArrived;
+    _arrived.notify_all();
+    if(!_arrived.wait_for(lock, std::chrono::seconds(10), [&] { return _nArrived >= _nExpected; })) {
+      timedOut = true;
+    }
+  }
+
+  std::atomic<bool> timedOut{false};
+
+ private:
+  std::mutex _mutex;
+  std::condition_variable _arrived;
+  size_t _nExpected;
+  size_t _nArrived{0};
+};
+
+/**********************************************************************************************************************/
+
 class TestTransferGroupDummy : public ChimeraTK::DummyBackend {
  public:
   TestTransferGroupDummy(std::string mapFileName) : DummyBackend(mapFileName) {}
@@ -55,9 +83,13 @@ class TestTransferGroupDummy : public ChimeraTK::DummyBackend {
     last_address = address;
     last_sizeInBytes = sizeInBytes;
     numberOfTransfers++;
+    if(rendezvous) rendezvous->wait();
     DummyBackend::read(bar, address, data, sizeInBytes);
   }
 
+  // If set, each read waits at the rendezvous. Set it only while no read is in progress.
+  boost::shared_ptr<Rendezvous> rendezvous;
+
   std::atomic<size_t> numberOfTransfers{0};
   std::atomic<uint64_t> last_bar;
   std::atomic<uint64_t> last_address;
@@ -367,3 +399,297 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(testTriggerTransferGroup, T, test_types) {
 
   dev.close();
 }
+
+/*********************************************************************************************************************/
+/* test that registers of different devices driven by the same trigger are read concurrently */
+
+struct TwoDeviceApplication : public ctk::Application {
+  TwoDeviceApplication() : Application("testSuite") {
+    ChimeraTK::BackendFactory::getInstance().registerBackendType(
+        "TestTransferGroupDummy", "", &TestTransferGroupDummy::createInstance, CHIMERATK_DEVICEACCESS_VERSION);
+  }
+  ~TwoDeviceApplication() { shutdown(); }
+
+  void defineConnections() {
+    dev("/REG1")[testModule.theTrigger] >> testModule.consumingPush;
+    dev2("/MODULE/REG1")[testModule.theTrigger] >> testModule.consumingPush2;
+  }
+
+  TestModule<int32_t> testModule{this, "testModule", "The test module"};
+  ctk::DeviceModule dev{this, dummySdm};
+  ctk::DeviceModule dev2{this, dummySdm2};
+};
+
+BOOST_AUTO_TEST_CASE(testTriggerDevicesConcurrently) {
+  std::cout << "***************************************************************"
+               "******************************************************"
+            << std::endl;
+  std::cout << "==> testTriggerDevicesConcurrently" << std::endl;
+
+  ChimeraTK::BackendFactory::getInstance().setDMapFilePath("test.dmap");
+
+  TwoDeviceApplication app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  app.run();
+  app.testModule.mainLoopStarted.wait(); // make sure the module's mainLoop() is entered
+
+  auto backend = boost::dynamic_pointer_cast<TestTransferGroupDummy>(
+      ChimeraTK::BackendFactory::getInstance().createBackend(dummySdm));
+  auto backend2 = boost::dynamic_pointer_cast<TestTransferGroupDummy>(
+      ChimeraTK::BackendFactory::getInstance().createBackend(dummySdm2));
+  BOOST_REQUIRE(backend != nullptr);
+  BOOST_REQUIRE(backend2 != nullptr);
+  BOOST_REQUIRE(backend != backend2);
+
+  // The read of each device waits until the other device is read as well. If the reads were serialised, the
+  // rendezvous would time out.
+  auto rendezvous = boost::make_shared<Rendezvous>(2);
+  backend->rendezvous = rendezvous;
+  backend2->rendezvous = rendezvous;
+  app.testModule.theTrigger.write();
+  app.testModule.consumingPush.read();
+  app.testModule.consumingPush2.read();
+  backend->rendezvous.reset();
+  backend2->rendezvous.reset();
+
+  BOOST_CHECK(!rendezvous->timedOut);
+}
+
+/*********************************************************************************************************************/
+/* test the pipelined mode, in which the data is distributed while the next trigger is processed */
+
+BOOST_AUTO_TEST_CASE(testPipelinedTrigger) {
+  std::cout << "***************************************************************"
+               "******************************************************"
+            << std::endl;
+  std::cout << "==> testPipelinedTrigger" << std::endl;
+
+  ChimeraTK::BackendFactory::getInstance().setDMapFilePath("test.dmap");
+
+  TestApplication<int32_t> app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.enableTriggerPipelining();
+
+  ChimeraTK::Device dev;
+  dev.open(dummySdm);
+
+  app.dev2("/REG1")[app.testModule.theTrigger] >> app.testModule.consumingPush;
+  app.dev2("/REG2")[app.testModule.theTrigger] >> app.testModule.consumingPush2;
+  app.initialise();
+  app.run();
+  app.testModule.mainLoopStarted.wait(); // make sure the module's mainLoop() is entered
+
+  // all values arrive in order, consistently for both consumers
+  for(int32_t i = 1; i <= 20; ++i) {
+    dev.write("/REG1", i);
+    dev.write("/REG2", 100 + i);
+    app.testModule.theTrigger.write();
+    app.testModule.consumingPush.read();
+    app.testModule.consumingPush2.read();
+    BOOST_CHECK_EQUAL(int32_t(app.testModule.consumingPush), i);
+    BOOST_CHECK_EQUAL(int32_t(app.testModule.consumingPush2), 100 + i);
+    BOOST_CHECK(app.testModule.consumingPush.getVersionNumber() == app.testModule.consumingPush2.getVersionNumber());
+  }
+
+  // many triggers in a row without waiting for the consumers: the latest value is always received
+  for(int32_t i = 0; i < 100; ++i) app.testModule.theTrigger.write();
+  dev.write("/REG1", 42);
+  app.testModule.theTrigger.write();
+  CHECK_TIMEOUT((app.testModule.consumingPush.readLatest(), int32_t(app.testModule.consumingPush) == 42), 10000);
+
+  dev.close();
+}
+
+/*********************************************************************************************************************/
+/* test that adjacent registers of different user types read with the same trigger are fetched in a single transfer
+ * and scattered correctly to the consumers */
+
+BOOST_AUTO_TEST_CASE(testTriggerCoalescedReads) {
+  std::cout << "***************************************************************"
+               "******************************************************"
+            << std::endl;
+  std::cout << "==> testTriggerCoalescedReads" << std::endl;
+
+  ChimeraTK::BackendFactory::getInstance().setDMapFilePath("test.dmap");
+
+  TestApplication<int32_t> app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+
+  ChimeraTK::Device dev;
+  dev.open(dummySdm);
+  auto backend = boost::dynamic_pointer_cast<TestTransferGroupDummy>(
+      ChimeraTK::BackendFactory::getInstance().createBackend(dummySdm));
+  BOOST_REQUIRE(backend != nullptr);
+
+  // REG1 to REG4 and AREA1 cover the address range 0 to 32 without gaps
+  app.dev2("/REG1", typeid(int32_t), 1)[app.testModule.theTrigger] >> app.cs("reg1");
+  app.dev2("/REG2", typeid(double), 1)[app.testModule.theTrigger] >> app.cs("reg2");
+  app.dev2("/REG3", typeid(int16_t), 1)[app.testModule.theTrigger] >> app.cs("reg3");
+  app.dev2("/REG4", typeid(uint8_t), 1)[app.testModule.theTrigger] >> app.cs("reg4");
+  app.dev2("/AREA1", typeid(int32_t), 4)[app.testModule.theTrigger] >> app.cs("area1");
+  app.initialise();
+  app.run();
+  app.testModule.mainLoopStarted.wait(); // make sure the module's mainLoop() is entered
+
+  auto reg1 = pvManagers.first->getProcessArray<int32_t>("/reg1");
+  auto reg2 = pvManagers.first->getProcessArray<double>("/reg2");
+  auto reg3 = pvManagers.first->getProcessArray<int16_t>("/reg3");
+  auto reg4 = pvManagers.first->getProcessArray<uint8_t>("/reg4");
+  auto area1 = pvManagers.first->getProcessArray<int32_t>("/area1");
+
+  // from the initial value transfer
+  CHECK_TIMEOUT(backend->numberOfTransfers == 1, 10000);
+  reg1->read();
+  reg2->read();
+  reg3->read();
+  reg4->read();
+  area1->read();
+
+  dev.write("/REG1", 1);
+  dev.write("/REG2", 2);
+  dev.write("/REG3", 3);
+  dev.write("/REG4", 4);
+  dev.write("/AREA1", std::vector<int32_t>{5, 6, 7, 8});
+
+  app.testModule.theTrigger.write();
+  reg1->read();
+  reg2->read();
+  reg3->read();
+  reg4->read();
+  area1->read();
+
+  BOOST_CHECK_EQUAL(backend->numberOfTransfers, 2);
+  BOOST_CHECK_EQUAL(backend->last_address, 0);
+  BOOST_CHECK_EQUAL(backend->last_sizeInBytes, 32);
+
+  BOOST_CHECK_EQUAL(reg1->accessData(0), 1);
+  BOOST_CHECK_CLOSE(reg2->accessData(0), 2., 1e-6);
+  BOOST_CHECK_EQUAL(reg3->accessData(0), 3);
+  BOOST_CHECK_EQUAL(reg4->accessData(0), 4);
+  BOOST_CHECK(area1->accessChannel(0) == std::vector<int32_t>({5, 6, 7, 8}));
+
+  dev.close();
+}
+
+/*********************************************************************************************************************/
+/* test the trigger prescaler */
+
+BOOST_AUTO_TEST_CASE(testTriggerPrescaler) {
+  std::cout << "***************************************************************"
+               "******************************************************"
+            << std::endl;
+  std::cout << "==> testTriggerPrescaler" << std::endl;
+
+  ChimeraTK::BackendFactory::getInstance().setDMapFilePath("test.dmap");
+
+  TestApplication<int32_t> app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+
+  ChimeraTK::Device dev;
+  dev.open(dummySdm);
+
+  BOOST_CHECK_THROW(app.testModule.theTrigger.every(0), ctk::logic_error);
+
+  app.dev2("/REG1")[app.testModule.theTrigger] >> app.testModule.consumingPush;
+  app.dev2("/REG2")[app.testModule.theTrigger.every(3)] >> app.testModule.consumingPush2;
+  app.initialise();
+  app.run();
+  app.testModule.mainLoopStarted.wait(); // make sure the module's mainLoop() is entered
+
+  for(int32_t i = 1; i <= 6; ++i) {
+    dev.write("/REG1", i);
+    dev.write("/REG2", 100 + i);
+    app.testModule.theTrigger.write();
+
+    // the register without prescaler is read on every trigger
+    app.testModule.consumingPush.read();
+    BOOST_CHECK_EQUAL(int32_t(app.testModule.consumingPush), i);
+
+    // the register with prescaler is only read on every 3rd trigger, in the same cycle as the other register
+    if(i % 3 == 0) {
+      app.testModule.consumingPush2.read();
+      BOOST_CHECK_EQUAL(int32_t(app.testModule.consumingPush2), 100 + i);
+      BOOST_CHECK(
+          app.testModule.consumingPush2.getVersionNumber() == app.testModule.consumingPush.getVersionNumber());
+    }
+    else {
+      BOOST_CHECK(app.testModule.consumingPush2.readNonBlocking() == false);
+    }
+  }
+
+  dev.close();
+}
+
+/*********************************************************************************************************************/
+/* test the timer as a trigger source, which is read directly by the TriggerFanOut */
+
+BOOST_AUTO_TEST_CASE(testTimerTrigger) {
+  std::cout << "***************************************************************"
+               "******************************************************"
+            << std::endl;
+  std::cout << "==> testTimerTrigger" << std::endl;
+
+  ChimeraTK::BackendFactory::getInstance().setDMapFilePath("test.dmap");
+
+  BOOST_CHECK_THROW(ctk::VariableNetworkNode::makeTimer(std::chrono::milliseconds(0)), ctk::logic_error);
+
+  TestApplication<int32_t> app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+
+  ChimeraTK::Device dev;
+  dev.open(dummySdm);
+  dev.write("/REG1", 42);
+
+  app.dev2("/REG1")[ctk::VariableNetworkNode::makeTimer(std::chrono::milliseconds(20))] >>
+      app.testModule.consumingPush;
+  app.initialise();
+  app.run();
+  app.testModule.mainLoopStarted.wait(); // make sure the module's mainLoop() is entered
+
+  // the initial value is read without waiting for the first period
+  BOOST_CHECK_EQUAL(int32_t(app.testModule.consumingPush), 42);
+
+  // discard queued ticks and synchronise to the next tick, which serves as reference
+  app.testModule.consumingPush.readLatest();
+  app.testModule.consumingPush.read();
+
+  // each tick delivers a new version. The ticks are never early, but may be late on a loaded system, so only the
+  // lower bound of the elapsed time is checked.
+  auto t0 = std::chrono::steady_clock::now();
+  for(size_t i = 0; i < 10; ++i) {
+    auto lastVersion = app.testModule.consumingPush.getVersionNumber();
+    app.testModule.consumingPush.read();
+    BOOST_CHECK(app.testModule.consumingPush.getVersionNumber() > lastVersion);
+    BOOST_CHECK_EQUAL(int32_t(app.testModule.consumingPush), 42);
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  BOOST_CHECK(t1 - t0 >= std::chrono::milliseconds(180));
+
+  // the register is read periodically without any further action
+  dev.write("/REG1", 120);
+  CHECK_TIMEOUT((app.testModule.consumingPush.readLatest(), int32_t(app.testModule.consumingPush) == 120), 10000);
+
+  dev.close();
+}
+
+/*********************************************************************************************************************/
+/* timers can only be used as triggers */
+
+BOOST_AUTO_TEST_CASE(testTimerNotAsTrigger) {
+  std::cout << "***************************************************************"
+               "******************************************************"
+            << std::endl;
+  std::cout << "==> testTimerNotAsTrigger" << std::endl;
+
+  ChimeraTK::BackendFactory::getInstance().setDMapFilePath("test.dmap");
+
+  TestApplication<uint64_t> app;
+  ctk::VariableNetworkNode::makeTimer(std::chrono::milliseconds(20)) >> app.testModule.consumingPush;
+  BOOST_CHECK_THROW(app.initialise(), ctk::logic_error);
+}